@@ -0,0 +1,352 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef CONCURRENT_MAP_H_
+#define CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "lock_util.h"
+
+namespace lock_util {
+
+// Handle -> state map with wait-free lookups, usable as a drop-in for the std::unordered_map subset the layers use
+// (find/end/begin/operator[]/insert/emplace/erase/count/size/empty/clear and range-for).
+//
+// Elements live in individually allocated nodes referenced from an open-addressed (linear probe) table of atomic pointers.
+// Lookups and iteration only load those pointers, so they never block and never observe a partially built element.
+// Mutations are serialized by an internal mutex; an erased node (and a table replaced by a rehash) is retired to the
+// shared EpochDomain and destroyed once no lock-free reader can still reach it. Retired items are reclaimed in batches by
+// later mutations, inserts included, so a create/destroy call only pays for the epoch machinery every so often.
+//
+// That covers values the map owns (including unique_ptr). A raw pointer value is just copied out of the node, so the object
+// it points to must be released through erase(key, release), which defers release() exactly like the node itself; release()
+// runs under the map's internal mutex on a later mutation, or from the destructor, so it must not touch the map.
+//
+// Contract for readers: references and iterators are valid while writers are excluded by some other means (e.g. the
+// layer's global lock), or while the reader holds an EpochGuard. Element references are stable across inserts/rehashes;
+// iterators are invalidated by a rehash, as with std::unordered_map. Concurrent writes to the *same* element are the
+// caller's problem, exactly as for any other state object.
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ConcurrentUnorderedMap {
+   public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = size_t;
+
+   private:
+    struct Node {
+        template <typename... Args>
+        explicit Node(Args &&... args) : value(std::forward<Args>(args)...) {}
+        value_type value;
+    };
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(new std::atomic<Node *>[capacity]) {
+            for (size_t i = 0; i < capacity; ++i) slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+        ~Table() { delete[] slots; }
+        size_t Capacity() const { return mask + 1; }
+        const size_t mask;
+        std::atomic<Node *> *slots;
+    };
+
+    // Marks an erased slot. Probes continue past it; inserts may reuse it.
+    static Node *Tombstone() { return reinterpret_cast<Node *>(uintptr_t(1)); }
+    static bool IsLive(const Node *node) { return node && (node != Tombstone()); }
+
+    static const size_t kMinCapacity = 16;
+
+    // Handles are frequently aligned pointers and std::hash is the identity for those, so scramble before masking
+    static size_t HomeSlot(const Key &key, size_t mask) {
+        uint64_t h = static_cast<uint64_t>(Hash()(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h) & mask;
+    }
+
+   public:
+    template <typename ValueRef, typename ValuePtr>
+    class IteratorBase {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ConcurrentUnorderedMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValuePtr;
+        using reference = ValueRef;
+
+        IteratorBase() : table_(nullptr), index_(0), node_(nullptr) {}
+        // const_iterator from iterator
+        template <typename R, typename P>
+        IteratorBase(const IteratorBase<R, P> &other) : table_(other.table_), index_(other.index_), node_(other.node_) {}
+
+        reference operator*() const { return node_->value; }
+        pointer operator->() const { return &node_->value; }
+        IteratorBase &operator++() {
+            ++index_;
+            Settle();
+            return *this;
+        }
+        IteratorBase operator++(int) {
+            IteratorBase tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+        // End iterators carry no node, so they compare equal regardless of which table they were taken from
+        template <typename R, typename P>
+        bool operator==(const IteratorBase<R, P> &other) const {
+            return node_ == other.node_;
+        }
+        template <typename R, typename P>
+        bool operator!=(const IteratorBase<R, P> &other) const {
+            return node_ != other.node_;
+        }
+
+       private:
+        friend class ConcurrentUnorderedMap;
+        template <typename R, typename P>
+        friend class IteratorBase;
+
+        IteratorBase(const Table *table, size_t index, Node *node) : table_(table), index_(index), node_(node) {}
+
+        // Advance to the first live node at or after index_. The node is cached so a dereference never rereads the slot.
+        void Settle() {
+            node_ = nullptr;
+            if (!table_) return;
+            for (; index_ < table_->Capacity(); ++index_) {
+                Node *node = table_->slots[index_].load(std::memory_order_acquire);
+                if (IsLive(node)) {
+                    node_ = node;
+                    return;
+                }
+            }
+        }
+
+        const Table *table_;
+        size_t index_;
+        Node *node_;
+    };
+    using iterator = IteratorBase<value_type &, value_type *>;
+    using const_iterator = IteratorBase<const value_type &, const value_type *>;
+
+    ConcurrentUnorderedMap() : table_(new Table(kMinCapacity)), size_(0), used_(0), reclaim_at_(kReclaimBatch) {}
+    ~ConcurrentUnorderedMap() {
+        // No readers may remain at destruction, so everything can go immediately
+        Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < table->Capacity(); ++i) {
+            Node *node = table->slots[i].load(std::memory_order_relaxed);
+            if (IsLive(node)) delete node;
+        }
+        delete table;
+        retired_.ReclaimAll(FreeRetired);
+    }
+    ConcurrentUnorderedMap(const ConcurrentUnorderedMap &) = delete;
+    ConcurrentUnorderedMap &operator=(const ConcurrentUnorderedMap &) = delete;
+
+    // Lookups: wait-free
+    iterator find(const Key &key) { return FindIn<iterator>(table_.load(std::memory_order_acquire), key); }
+    const_iterator find(const Key &key) const { return FindIn<const_iterator>(table_.load(std::memory_order_acquire), key); }
+    size_type count(const Key &key) const { return (find(key) != end()) ? 1 : 0; }
+    size_type size() const { return size_.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+
+    iterator begin() { return MakeBegin<iterator>(); }
+    const_iterator begin() const { return MakeBegin<const_iterator>(); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cend() const { return end(); }
+
+    // Mutations: serialized
+    T &operator[](const Key &key) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        iterator it = FindIn<iterator>(table_.load(std::memory_order_relaxed), key);
+        if (it != end()) return it->second;
+        Node *node = InsertNode(new Node(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()));
+        MaybeReclaim();
+        return node->value.second;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&... args) {
+        std::unique_ptr<Node> node(new Node(std::forward<Args>(args)...));
+        std::lock_guard<std::mutex> guard(write_lock_);
+        iterator it = FindIn<iterator>(table_.load(std::memory_order_relaxed), node->value.first);
+        if (it != end()) return std::make_pair(it, false);
+        InsertNode(node.get());
+        Node *inserted = node.release();
+        MaybeReclaim();
+        return std::make_pair(FindIn<iterator>(table_.load(std::memory_order_relaxed), inserted->value.first), true);
+    }
+
+    template <typename Pair>
+    std::pair<iterator, bool> insert(Pair &&value) {
+        return emplace(std::forward<Pair>(value));
+    }
+
+    size_type erase(const Key &key) { return erase(key, std::function<void()>()); }
+
+    // For maps of raw pointers: as erase(key), and release() (which frees whatever the mapped value refers to) is deferred
+    // along with the node, so lock-free readers that found the element can keep using the object it points to
+    size_type erase(const Key &key, std::function<void()> release) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        iterator it = FindIn<iterator>(table_.load(std::memory_order_relaxed), key);
+        if (it == end()) return 0;
+        EraseAt(it, std::move(release));
+        MaybeReclaim();
+        return 1;
+    }
+
+    // Returns the iterator following the erased element; erase never rehashes, so iteration can continue
+    iterator erase(const_iterator pos) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        iterator it(pos.table_, pos.index_, pos.node_);
+        EraseAt(it, std::function<void()>());
+        MaybeReclaim();
+        ++it;
+        return it;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        Table *old_table = table_.load(std::memory_order_relaxed);
+        table_.store(new Table(kMinCapacity), std::memory_order_release);
+        size_.store(0, std::memory_order_release);
+        used_ = 0;
+        for (size_t i = 0; i < old_table->Capacity(); ++i) {
+            Node *node = old_table->slots[i].load(std::memory_order_relaxed);
+            if (IsLive(node)) retired_.Retire(Retired(node));
+        }
+        retired_.Retire(Retired(old_table));
+        MaybeReclaim();
+    }
+
+   private:
+    // A node or table unlinked from the map, waiting out the readers that might still hold it
+    struct Retired {
+        explicit Retired(Node *n, std::function<void()> r = std::function<void()>())
+            : node(n), table(nullptr), release(std::move(r)) {}
+        explicit Retired(Table *tb) : node(nullptr), table(tb) {}
+        Node *node;
+        Table *table;
+        std::function<void()> release;  // Frees what a raw pointer value referred to, see erase(key, release)
+    };
+    static void FreeRetired(Retired &retired) {
+        if (retired.release) retired.release();
+        delete retired.node;
+        delete retired.table;
+    }
+
+    static const size_t kReclaimBatch = 32;
+
+    template <typename Iterator>
+    Iterator FindIn(const Table *table, const Key &key) const {
+        const size_t capacity = table->Capacity();
+        size_t index = HomeSlot(key, table->mask);
+        // The table always keeps empty slots (see InsertNode), so the probe terminates
+        for (size_t probes = 0; probes < capacity; ++probes, index = (index + 1) & table->mask) {
+            Node *node = table->slots[index].load(std::memory_order_acquire);
+            if (!node) break;
+            if ((node != Tombstone()) && KeyEqual()(node->value.first, key)) return Iterator(table, index, node);
+        }
+        return Iterator();
+    }
+
+    template <typename Iterator>
+    Iterator MakeBegin() const {
+        Iterator it(table_.load(std::memory_order_acquire), 0, nullptr);
+        it.Settle();
+        return it;
+    }
+
+    // Requires write_lock_ and that the key is absent
+    Node *InsertNode(Node *node) {
+        Table *table = table_.load(std::memory_order_relaxed);
+        // Keep occupancy (live + tombstones) at or below one half so probes stay short and always hit an empty slot
+        if ((used_ + 1) * 2 > table->Capacity()) table = Rehash(table);
+        size_t index = HomeSlot(node->value.first, table->mask);
+        for (;; index = (index + 1) & table->mask) {
+            Node *slot = table->slots[index].load(std::memory_order_relaxed);
+            if (!slot) {
+                ++used_;
+                break;
+            }
+            if (slot == Tombstone()) break;
+        }
+        table->slots[index].store(node, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_release);
+        return node;
+    }
+
+    // Requires write_lock_. Builds a fresh table sized for the live elements (which also drops tombstones) and publishes it.
+    Table *Rehash(Table *old_table) {
+        const size_t live = size_.load(std::memory_order_relaxed);
+        size_t capacity = kMinCapacity;
+        while (capacity < (live + 1) * 4) capacity *= 2;
+        Table *new_table = new Table(capacity);
+        for (size_t i = 0; i < old_table->Capacity(); ++i) {
+            Node *node = old_table->slots[i].load(std::memory_order_relaxed);
+            if (!IsLive(node)) continue;
+            size_t index = HomeSlot(node->value.first, new_table->mask);
+            while (new_table->slots[index].load(std::memory_order_relaxed)) index = (index + 1) & new_table->mask;
+            new_table->slots[index].store(node, std::memory_order_relaxed);
+        }
+        used_ = live;
+        table_.store(new_table, std::memory_order_release);
+        retired_.Retire(Retired(old_table));
+        return new_table;
+    }
+
+    // Requires write_lock_
+    void EraseAt(const iterator &it, std::function<void()> release) {
+        assert(it.table_ == table_.load(std::memory_order_relaxed));
+        const_cast<Table *>(it.table_)->slots[it.index_].store(Tombstone(), std::memory_order_release);
+        size_.fetch_sub(1, std::memory_order_release);
+        retired_.Retire(Retired(it.node_, std::move(release)));
+    }
+
+    // Requires write_lock_. Once enough has been retired, frees whatever no pinned reader can still see. Whatever a pinned reader
+    // holds back raises the bar for the next attempt, so a long-lived pin doesn't turn every mutation into a slot scan.
+    void MaybeReclaim() {
+        if (retired_.size() < reclaim_at_) return;
+        retired_.Reclaim(FreeRetired);
+        reclaim_at_ = (2 * retired_.size() > kReclaimBatch) ? 2 * retired_.size() : kReclaimBatch;
+    }
+
+    std::atomic<Table *> table_;
+    std::atomic<size_t> size_;
+    size_t used_;  // live + tombstone slots in table_, guarded by write_lock_
+    std::mutex write_lock_;
+    RetireList<Retired> retired_;
+    size_t reclaim_at_;  // retired_ size that triggers the next reclaim, guarded by write_lock_
+};
+
+}  // namespace lock_util
+
+#endif  // CONCURRENT_MAP_H_
@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <array>
 #include <assert.h>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
@@ -51,6 +52,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <tuple>
 #include <valarray>
 
 #include "vk_loader_platform.h"
@@ -66,10 +68,12 @@
 #include "buffer_validation.h"
 #include "shader_validation.h"
 #include "vk_layer_table.h"
+#include "vk_layer_config.h"
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
 #include "vk_typemap_helper.h"
+#include "lock_util.h"
 
 #if defined __ANDROID__
 #include <android/log.h>
@@ -85,7 +89,41 @@
 // This intentionally includes a cpp file
 #include "vk_safe_struct.cpp"
 
-using mutex_t = std::mutex;
+// The global lock's mutex. A submission whose validation was deferred has not been recorded yet when vkQueueSubmit returns, so
+// every acquisition first waits for the outstanding deferred submissions of the device the calling thread entered the layer
+// through; no entry point sees that device's state from before an earlier submit, and other devices never wait on it. The
+// deferred task itself acquires through lock_deferred_submit().
+class DeferredSubmitMutex : public lock_util::ReadWriteMutex {
+   public:
+    void lock() {
+        WaitForDeferredSubmits();
+        ReadWriteMutex::lock();
+    }
+    void lock_shared() {
+        WaitForDeferredSubmits();
+        ReadWriteMutex::lock_shared();
+    }
+    void lock_deferred_submit() { ReadWriteMutex::lock(); }
+
+    // Records the deferred submits of the device the calling thread is entering the layer through, null if it defers none. The
+    // reference keeps them alive for a thread whose next entry is instance-level, after the device is gone.
+    static void EnterDevice(const std::shared_ptr<lock_util::PendingWork> &device_submits) {
+        std::shared_ptr<lock_util::PendingWork> &current = CurrentDeviceSubmits();
+        if (current != device_submits) current = device_submits;
+    }
+
+   private:
+    static std::shared_ptr<lock_util::PendingWork> &CurrentDeviceSubmits() {
+        static thread_local std::shared_ptr<lock_util::PendingWork> device_submits;
+        return device_submits;
+    }
+    static void WaitForDeferredSubmits() {
+        lock_util::PendingWork *device_submits = CurrentDeviceSubmits().get();
+        if (device_submits) device_submits->Wait();
+    }
+};
+
+using mutex_t = DeferredSubmitMutex;
 using lock_guard_t = std::lock_guard<mutex_t>;
 using unique_lock_t = std::unique_lock<mutex_t>;
 
@@ -125,6 +163,15 @@ bool PipelineLayoutCompatDef::operator==(const PipelineLayoutCompatDef &other) c
     return true;
 }
 
+// Pools are only deleted once no reader can reach them, and so none of their retired sets either
+DESCRIPTOR_POOL_STATE::~DESCRIPTOR_POOL_STATE() {
+    retired_sets.ReclaimAll([this](cvdescriptorset::DescriptorSet *set) { set_allocator.Delete(set); });
+}
+
+void DESCRIPTOR_POOL_STATE::ReclaimRetiredSets() {
+    retired_sets.Reclaim([this](cvdescriptorset::DescriptorSet *set) { set_allocator.Delete(set); });
+}
+
 namespace core_validation {
 
 using std::max;
@@ -159,6 +206,12 @@ struct instance_layer_data {
 
     InstanceExtensions extensions;
     uint32_t api_version;
+    // lunarg_core_validation.fine_grained_locking as read at instance creation, inherited by this instance's devices
+    bool fine_grained_locking = false;
+    // lunarg_core_validation.deferred_submit_validation as read at instance creation, inherited by this instance's devices
+    bool deferred_submit_validation = false;
+    // lunarg_core_validation.pipeline_validation_threads as read at instance creation, inherited by this instance's devices
+    uint32_t pipeline_validation_threads = 0;
 };
 
 struct layer_data {
@@ -168,32 +221,32 @@ struct layer_data {
     DeviceExtensions extensions = {};
     unordered_set<VkQueue> queues;  // All queues under given device
     // Layer specific data
-    unordered_map<VkSampler, unique_ptr<SAMPLER_STATE>> samplerMap;
-    unordered_map<VkImageView, unique_ptr<IMAGE_VIEW_STATE>> imageViewMap;
-    unordered_map<VkImage, unique_ptr<IMAGE_STATE>> imageMap;
-    unordered_map<VkBufferView, unique_ptr<BUFFER_VIEW_STATE>> bufferViewMap;
-    unordered_map<VkBuffer, unique_ptr<BUFFER_STATE>> bufferMap;
-    unordered_map<VkPipeline, unique_ptr<PIPELINE_STATE>> pipelineMap;
-    unordered_map<VkCommandPool, COMMAND_POOL_NODE> commandPoolMap;
-    unordered_map<VkDescriptorPool, DESCRIPTOR_POOL_STATE *> descriptorPoolMap;
-    unordered_map<VkDescriptorSet, cvdescriptorset::DescriptorSet *> setMap;
-    unordered_map<VkDescriptorSetLayout, std::shared_ptr<cvdescriptorset::DescriptorSetLayout>> descriptorSetLayoutMap;
-    unordered_map<VkPipelineLayout, PIPELINE_LAYOUT_NODE> pipelineLayoutMap;
-    unordered_map<VkDeviceMemory, unique_ptr<DEVICE_MEM_INFO>> memObjMap;
-    unordered_map<VkFence, FENCE_NODE> fenceMap;
-    unordered_map<VkQueue, QUEUE_STATE> queueMap;
-    unordered_map<VkEvent, EVENT_STATE> eventMap;
+    HandleMap<VkSampler, unique_ptr<SAMPLER_STATE>> samplerMap;
+    HandleMap<VkImageView, unique_ptr<IMAGE_VIEW_STATE>> imageViewMap;
+    HandleMap<VkImage, unique_ptr<IMAGE_STATE>> imageMap;
+    HandleMap<VkBufferView, unique_ptr<BUFFER_VIEW_STATE>> bufferViewMap;
+    HandleMap<VkBuffer, unique_ptr<BUFFER_STATE>> bufferMap;
+    HandleMap<VkPipeline, unique_ptr<PIPELINE_STATE>> pipelineMap;
+    HandleMap<VkCommandPool, COMMAND_POOL_NODE> commandPoolMap;
+    HandleMap<VkDescriptorPool, DESCRIPTOR_POOL_STATE *> descriptorPoolMap;
+    HandleMap<VkDescriptorSet, cvdescriptorset::DescriptorSet *> setMap;
+    HandleMap<VkDescriptorSetLayout, std::shared_ptr<cvdescriptorset::DescriptorSetLayout>> descriptorSetLayoutMap;
+    HandleMap<VkPipelineLayout, PIPELINE_LAYOUT_NODE> pipelineLayoutMap;
+    HandleMap<VkDeviceMemory, unique_ptr<DEVICE_MEM_INFO>> memObjMap;
+    HandleMap<VkFence, FENCE_NODE> fenceMap;
+    HandleMap<VkQueue, QUEUE_STATE> queueMap;
+    std::vector<QUEUE_STATE *> timeline_queues;  // Indexed by QUEUE_STATE::timeline_index
+    HandleMap<VkEvent, EVENT_STATE> eventMap;
     unordered_map<QueryObject, bool> queryToStateMap;
-    unordered_map<VkQueryPool, QUERY_POOL_NODE> queryPoolMap;
-    unordered_map<VkSemaphore, SEMAPHORE_NODE> semaphoreMap;
-    unordered_map<VkCommandBuffer, GLOBAL_CB_NODE *> commandBufferMap;
-    unordered_map<VkFramebuffer, unique_ptr<FRAMEBUFFER_STATE>> frameBufferMap;
-    unordered_map<VkImage, vector<ImageSubresourcePair>> imageSubresourceMap;
-    unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> imageLayoutMap;
-    unordered_map<VkRenderPass, std::shared_ptr<RENDER_PASS_STATE>> renderPassMap;
-    unordered_map<VkShaderModule, unique_ptr<shader_module>> shaderModuleMap;
-    unordered_map<VkDescriptorUpdateTemplateKHR, unique_ptr<TEMPLATE_STATE>> desc_template_map;
-    unordered_map<VkSwapchainKHR, std::unique_ptr<SWAPCHAIN_NODE>> swapchainMap;
+    HandleMap<VkQueryPool, QUERY_POOL_NODE> queryPoolMap;
+    HandleMap<VkSemaphore, SEMAPHORE_NODE> semaphoreMap;
+    HandleMap<VkCommandBuffer, GLOBAL_CB_NODE *> commandBufferMap;
+    HandleMap<VkFramebuffer, unique_ptr<FRAMEBUFFER_STATE>> frameBufferMap;
+    ImageLayoutMap imageLayoutMap;
+    HandleMap<VkRenderPass, std::shared_ptr<RENDER_PASS_STATE>> renderPassMap;
+    HandleMap<VkShaderModule, unique_ptr<shader_module>> shaderModuleMap;
+    HandleMap<VkDescriptorUpdateTemplateKHR, unique_ptr<TEMPLATE_STATE>> desc_template_map;
+    HandleMap<VkSwapchainKHR, std::unique_ptr<SWAPCHAIN_NODE>> swapchainMap;
     GlobalQFOTransferBarrierMap<VkImageMemoryBarrier> qfo_release_image_barrier_map;
     GlobalQFOTransferBarrierMap<VkBufferMemoryBarrier> qfo_release_buffer_barrier_map;
 
@@ -215,12 +268,28 @@ struct layer_data {
     };
     DeviceExtensionProperties phys_dev_ext_props = {};
     bool external_sync_warning = false;
+    // Copied from the instance at device creation, so the locking mode never changes under a command buffer being recorded
+    bool fine_grained_locking = false;
+    // Runs vkQueueSubmit validation and state recording off the submitting thread when deferred_submit_validation is set
+    std::unique_ptr<lock_util::SerialWorker> deferred_submit_worker;
+    // Submissions posted to deferred_submit_worker and not yet recorded, waited out by global_lock acquisitions on this device
+    std::shared_ptr<lock_util::PendingWork> deferred_submits;
+    // Splits the shader/state validation of vkCreate*Pipelines batches when pipeline_validation_threads is set
+    std::unique_ptr<lock_util::WorkerPool> pipeline_validation_pool;
     uint32_t api_version = 0;
 };
 
-// TODO : Do we need to guard access to layer_data_map w/ lock?
-static unordered_map<void *, layer_data *> layer_data_map;
-static unordered_map<void *, instance_layer_data *> instance_layer_data_map;
+// Internally synchronized, see vk_layer_data.h
+static LayerDataMap<layer_data> layer_data_map;
+static LayerDataMap<instance_layer_data> instance_layer_data_map;
+
+// Device-level entry points look up their layer_data first, before taking global_lock. This overload of the vk_layer_data.h
+// template is preferred for layer_data_map, and tells global_lock which device's deferred submits this thread must wait out.
+static layer_data *GetLayerDataPtr(void *data_key, LayerDataMap<layer_data> &data_map) {
+    layer_data *device_data = ::GetLayerDataPtr<layer_data>(data_key, data_map);
+    DeferredSubmitMutex::EnterDevice(device_data->deferred_submits);
+    return device_data;
+}
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
@@ -249,8 +318,14 @@ void ValidateLayerOrdering(const TCreateInfo &createInfo) {
     }
 }
 
-// TODO : This can be much smarter, using separate locks for separate global data
+// Exclusive (unique_lock_t/lock_guard_t) for anything that creates, destroys, or submits state. With fine_grained_locking
+// enabled, recording-time entry points hold it shared via cb_lock_t instead, see below.
 static mutex_t global_lock;
+// Guards BASE_NODE::cb_bindings inserts made while global_lock is only held shared. Leaf lock; nothing is acquired under it.
+static lock_util::StripedMutex<> cb_bindings_locks;
+// Guards the draw-time per-CB caches of a descriptor set, which several CBs may record against concurrently. Taken
+// before (never under) a cb_bindings_locks stripe.
+static lock_util::StripedMutex<> descriptor_set_locks;
 
 // Get the global map of pending releases
 GlobalQFOTransferBarrierMap<VkImageMemoryBarrier> &GetGlobalQFOReleaseBarrierMap(
@@ -390,6 +465,65 @@ static BINDABLE *GetObjectMemBinding(layer_data *dev_data, uint64_t handle, Vulk
 // prototype
 GLOBAL_CB_NODE *GetCBNode(layer_data const *, const VkCommandBuffer);
 
+// Lock for recording-time entry points whose writes are confined to their own command buffer, plus cb_bindings inserts and
+// descriptor set draw-time caches (each covered by its striped lock). In fine-grained mode the layer_data maps are held shared
+// and the CB's recording_lock exclusively, so recording on distinct CBs proceeds in parallel. Otherwise it is the exclusive
+// global_lock. Same lock()/unlock() interface as unique_lock_t, for the validate/unlock/dispatch/lock/record pattern.
+class cb_lock_t {
+   public:
+    cb_lock_t(layer_data *dev_data, VkCommandBuffer command_buffer)
+        : dev_data_(dev_data),
+          command_buffer_(command_buffer),
+          fine_grained_(dev_data->fine_grained_locking),
+          cb_mutex_(nullptr),
+          owns_(false) {
+        lock();
+    }
+    ~cb_lock_t() {
+        if (owns_) unlock();
+    }
+    cb_lock_t(const cb_lock_t &) = delete;
+    cb_lock_t &operator=(const cb_lock_t &) = delete;
+
+    void lock() {
+        assert(!owns_);
+        if (fine_grained_) {
+            global_lock.lock_shared();
+            // The CB may have been freed while unlocked, so look it up again on every acquire
+            GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data_, command_buffer_);
+            cb_mutex_ = cb_state ? &cb_state->recording_lock : nullptr;
+            if (cb_mutex_) cb_mutex_->lock();
+        } else {
+            global_lock.lock();
+        }
+        owns_ = true;
+    }
+    void unlock() {
+        assert(owns_);
+        if (fine_grained_) {
+            if (cb_mutex_) cb_mutex_->unlock();
+            cb_mutex_ = nullptr;
+            global_lock.unlock_shared();
+        } else {
+            global_lock.unlock();
+        }
+        owns_ = false;
+    }
+
+   private:
+    layer_data *dev_data_;
+    VkCommandBuffer command_buffer_;
+    const bool fine_grained_;
+    std::mutex *cb_mutex_;
+    bool owns_;
+};
+
+// Add cb_node to an object's cb_bindings. Callers may only hold global_lock shared (see cb_lock_t).
+void InsertCommandBufferBinding(std::unordered_set<GLOBAL_CB_NODE *> *cb_bindings, GLOBAL_CB_NODE *cb_node) {
+    std::lock_guard<std::mutex> lock(cb_bindings_locks.Get(cb_bindings));
+    cb_bindings->insert(cb_node);
+}
+
 // Return ptr to info in map container containing mem, or NULL if not found
 //  Calls to this function should be wrapped in mutex
 DEVICE_MEM_INFO *GetMemObjInfo(const layer_data *dev_data, const VkDeviceMemory mem) {
@@ -417,7 +551,7 @@ static void add_mem_obj_info(layer_data *dev_data, void *object, const VkDeviceM
 
 // Create binding link between given sampler and command buffer node
 void AddCommandBufferBindingSampler(GLOBAL_CB_NODE *cb_node, SAMPLER_STATE *sampler_state) {
-    sampler_state->cb_bindings.insert(cb_node);
+    InsertCommandBufferBinding(&sampler_state->cb_bindings, cb_node);
     cb_node->object_bindings.insert({HandleToUint64(sampler_state->sampler), kVulkanObjectTypeSampler});
 }
 
@@ -429,21 +563,21 @@ void AddCommandBufferBindingImage(const layer_data *dev_data, GLOBAL_CB_NODE *cb
         for (auto mem_binding : image_state->GetBoundMemory()) {
             DEVICE_MEM_INFO *pMemInfo = GetMemObjInfo(dev_data, mem_binding);
             if (pMemInfo) {
-                pMemInfo->cb_bindings.insert(cb_node);
+                InsertCommandBufferBinding(&pMemInfo->cb_bindings, cb_node);
                 // Now update CBInfo's Mem reference list
                 cb_node->memObjs.insert(mem_binding);
             }
         }
         // Now update cb binding for image
         cb_node->object_bindings.insert({HandleToUint64(image_state->image), kVulkanObjectTypeImage});
-        image_state->cb_bindings.insert(cb_node);
+        InsertCommandBufferBinding(&image_state->cb_bindings, cb_node);
     }
 }
 
 // Create binding link between given image view node and its image with command buffer node
 void AddCommandBufferBindingImageView(const layer_data *dev_data, GLOBAL_CB_NODE *cb_node, IMAGE_VIEW_STATE *view_state) {
     // First add bindings for imageView
-    view_state->cb_bindings.insert(cb_node);
+    InsertCommandBufferBinding(&view_state->cb_bindings, cb_node);
     cb_node->object_bindings.insert({HandleToUint64(view_state->image_view), kVulkanObjectTypeImageView});
     auto image_state = GetImageState(dev_data, view_state->create_info.image);
     // Add bindings for image within imageView
@@ -458,20 +592,20 @@ void AddCommandBufferBindingBuffer(const layer_data *dev_data, GLOBAL_CB_NODE *c
     for (auto mem_binding : buffer_state->GetBoundMemory()) {
         DEVICE_MEM_INFO *pMemInfo = GetMemObjInfo(dev_data, mem_binding);
         if (pMemInfo) {
-            pMemInfo->cb_bindings.insert(cb_node);
+            InsertCommandBufferBinding(&pMemInfo->cb_bindings, cb_node);
             // Now update CBInfo's Mem reference list
             cb_node->memObjs.insert(mem_binding);
         }
     }
     // Now update cb binding for buffer
     cb_node->object_bindings.insert({HandleToUint64(buffer_state->buffer), kVulkanObjectTypeBuffer});
-    buffer_state->cb_bindings.insert(cb_node);
+    InsertCommandBufferBinding(&buffer_state->cb_bindings, cb_node);
 }
 
 // Create binding link between given buffer view node and its buffer with command buffer node
 void AddCommandBufferBindingBufferView(const layer_data *dev_data, GLOBAL_CB_NODE *cb_node, BUFFER_VIEW_STATE *view_state) {
     // First add bindings for bufferView
-    view_state->cb_bindings.insert(cb_node);
+    InsertCommandBufferBinding(&view_state->cb_bindings, cb_node);
     cb_node->object_bindings.insert({HandleToUint64(view_state->buffer_view), kVulkanObjectTypeBufferView});
     auto buffer_state = GetBufferState(dev_data, view_state->create_info.buffer);
     // Add bindings for buffer within bufferView
@@ -681,7 +815,7 @@ static bool SetSparseMemBinding(layer_data *dev_data, MEM_BINDING binding, uint6
 
 // Check object status for selected flag state
 static bool validate_status(layer_data *dev_data, GLOBAL_CB_NODE *pNode, CBStatusFlags status_mask, VkFlags msg_flags,
-                            const char *fail_msg, std::string const msg_code) {
+                            const char *fail_msg, const char *msg_code) {
     if (!(pNode->status & status_mask)) {
         return log_msg(dev_data->report_data, msg_flags, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                        HandleToUint64(pNode->commandBuffer), msg_code, "command buffer object 0x%" PRIx64 ": %s..",
@@ -760,7 +894,7 @@ static bool isDynamic(const PIPELINE_STATE *pPipeline, const VkDynamicState stat
 
 // Validate state stored as flags at time of draw call
 static bool validate_draw_state_flags(layer_data *dev_data, GLOBAL_CB_NODE *pCB, const PIPELINE_STATE *pPipe, bool indexed,
-                                      std::string const msg_code) {
+                                      const char *msg_code) {
     bool result = false;
     if (pPipe->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_LIST ||
         pPipe->topology_at_rasterizer == VK_PRIMITIVE_TOPOLOGY_LINE_STRIP) {
@@ -1127,11 +1261,16 @@ static bool verify_set_layout_compatibility(const cvdescriptorset::DescriptorSet
     return descriptor_set->IsCompatible(layout_node.get(), &errorMsg);
 }
 
+// Forget cached results of the graphics draw-time checks that read the given state
+static void MarkDrawStateDirty(GLOBAL_CB_NODE *cb_state, DrawStateDirtyFlags dirty) {
+    cb_state->lastBound[VK_PIPELINE_BIND_POINT_GRAPHICS].draw_validation.MarkDirty(dirty);
+}
+
 // Validate overall state at the time of a draw call
 static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, CMD_TYPE cmd_type, const bool indexed,
-                              const VkPipelineBindPoint bind_point, const char *function, std::string const msg_code) {
+                              const VkPipelineBindPoint bind_point, const char *function, const char *msg_code) {
     bool result = false;
-    auto const &state = cb_node->lastBound[bind_point];
+    auto &state = cb_node->lastBound[bind_point];
     PIPELINE_STATE *pPipe = state.pipeline_state;
     if (nullptr == pPipe) {
         result |= log_msg(
@@ -1141,9 +1280,22 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, CMD
         // Early return as any further checks below will be busted w/o a pipeline
         if (result) return true;
     }
+
+    // Checks that last ran without a message, and whose inputs haven't been marked dirty since, are skipped. Only clean results
+    // are reused, so every draw still reports every problem. An invalidated command buffer may have lost bound objects without
+    // anything being marked, so it gets the full set.
+    auto &cache = state.draw_validation;
+    if (cb_node->state != CB_RECORDING) cache.Reset();
+
     // First check flag states
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point)
-        result = validate_draw_state_flags(dev_data, cb_node, pPipe, indexed, msg_code);
+    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
+        const auto check = indexed ? DRAW_VALIDATION_CACHE::kStateFlagsIndexed : DRAW_VALIDATION_CACHE::kStateFlags;
+        if (!cache.IsClean(check)) {
+            const uint64_t messages_before = LogMsgCount();
+            result = validate_draw_state_flags(dev_data, cb_node, pPipe, indexed, msg_code);
+            cache.SetClean(check, LogMsgCount() == messages_before);
+        }
+    }
 
     // Now complete other state checks
     string errorString;
@@ -1151,26 +1303,33 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, CMD
 
     for (const auto &set_binding_pair : pPipe->active_slots) {
         uint32_t setIndex = set_binding_pair.first;
+        cvdescriptorset::DescriptorSet *descriptor_set =
+            (setIndex < state.boundDescriptorSets.size()) ? state.boundDescriptorSets[setIndex] : nullptr;
+        // Read the version before validating, so an update racing with this draw leaves the set dirty
+        const uint64_t update_count = descriptor_set ? descriptor_set->GetUpdateCount() : 0;
+        if (descriptor_set && cache.IsSetClean(setIndex, update_count, cb_node->image_layout_change_count)) continue;
+        const uint64_t messages_before = LogMsgCount();
+
         // If valid set is not bound throw an error
-        if ((state.boundDescriptorSets.size() <= setIndex) || (!state.boundDescriptorSets[setIndex])) {
+        if (!descriptor_set) {
             result |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                               HandleToUint64(cb_node->commandBuffer), DRAWSTATE_DESCRIPTOR_SET_NOT_BOUND,
                               "VkPipeline 0x%" PRIx64 " uses set #%u but that set is not bound.", HandleToUint64(pPipe->pipeline),
                               setIndex);
-        } else if (!verify_set_layout_compatibility(state.boundDescriptorSets[setIndex], &pipeline_layout, setIndex, errorString)) {
+        } else if (!verify_set_layout_compatibility(descriptor_set, &pipeline_layout, setIndex, errorString)) {
             // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
-            VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
+            VkDescriptorSet setHandle = descriptor_set->GetSet();
             result |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
                               HandleToUint64(setHandle), DRAWSTATE_PIPELINE_LAYOUTS_INCOMPATIBLE,
                               "VkDescriptorSet (0x%" PRIx64
                               ") bound as set #%u is not compatible with overlapping VkPipelineLayout 0x%" PRIx64 " due to: %s",
                               HandleToUint64(setHandle), setIndex, HandleToUint64(pipeline_layout.layout), errorString.c_str());
         } else {  // Valid set is bound and layout compatible, validate that it's updated
-            // Pull the set node
-            cvdescriptorset::DescriptorSet *descriptor_set = state.boundDescriptorSets[setIndex];
             // Validate the draw-time state for this descriptor set
             std::string err_str;
             if (!descriptor_set->IsPushDescriptor()) {
+                // Prefiltering updates the set's per-CB validation cache, which other CBs may be touching concurrently
+                std::lock_guard<std::mutex> set_lock(descriptor_set_locks.Get(descriptor_set));
                 // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor
                 // binding validation. Take the requested binding set and prefilter it to eliminate redundant validation checks.
                 // Here, the currently bound pipeline determines whether an image validation check is redundant...
@@ -1190,11 +1349,17 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, CMD
                 }
             }
         }
+        if (descriptor_set) {
+            cache.SetSetClean(setIndex, LogMsgCount() == messages_before, update_count, cb_node->image_layout_change_count);
+        }
     }
 
     // Check general pipeline state that needs to be validated at drawtime
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point)
+    if ((VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) && !cache.IsClean(DRAW_VALIDATION_CACHE::kPipelineDrawtime)) {
+        const uint64_t messages_before = LogMsgCount();
         result |= ValidatePipelineDrawtimeState(dev_data, state, cb_node, cmd_type, pPipe, function);
+        cache.SetClean(DRAW_VALIDATION_CACHE::kPipelineDrawtime, LogMsgCount() == messages_before);
+    }
 
     return result;
 }
@@ -1208,6 +1373,7 @@ static void UpdateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_state, cons
             // Pull the set node
             cvdescriptorset::DescriptorSet *descriptor_set = state.boundDescriptorSets[setIndex];
             if (!descriptor_set->IsPushDescriptor()) {
+                std::lock_guard<std::mutex> set_lock(descriptor_set_locks.Get(descriptor_set));
                 // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor binding
                 const cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second, cb_state);
                 const auto &binding_req_map = reduced_map.Map();
@@ -1616,10 +1782,13 @@ static bool validateIdleDescriptorSetForPoolReset(const layer_data *dev_data, co
     return skip;
 }
 
-// Remove set from setMap and delete the set
+// Remove set from setMap and retire it to its pool, whose allocator gets it back once no lock-free reader can still hold it
 static void freeDescriptorSet(layer_data *dev_data, cvdescriptorset::DescriptorSet *descriptor_set) {
+    // Invalidate now, while the bound cmd buffers are known to be alive; the deferred delete must not touch them
+    descriptor_set->InvalidateBoundCmdBuffers();
+    descriptor_set->cb_bindings.clear();
     dev_data->setMap.erase(descriptor_set->GetSet());
-    delete descriptor_set;
+    descriptor_set->GetPoolState()->retired_sets.Retire(descriptor_set);
 }
 // Free all DS Pools including their Sets & related sub-structs
 // NOTE : Calls to this function should be wrapped in mutex
@@ -1644,6 +1813,7 @@ static void clearDescriptorPool(layer_data *dev_data, const VkDevice device, con
         freeDescriptorSet(dev_data, ds);
     }
     pPool->sets.clear();
+    pPool->ReclaimRetiredSets();
     // Reset available count for each type and available sets for this pool
     for (uint32_t i = 0; i < pPool->availableDescriptorTypeCount.size(); ++i) {
         pPool->availableDescriptorTypeCount[i] = pPool->maxDescriptorTypeCount[i];
@@ -1678,7 +1848,7 @@ bool ValidateCmdSubpassState(const layer_data *dev_data, const GLOBAL_CB_NODE *p
 }
 
 bool ValidateCmdQueueFlags(layer_data *dev_data, const GLOBAL_CB_NODE *cb_node, const char *caller_name,
-                           VkQueueFlags required_flags, const std::string &error_code) {
+                           VkQueueFlags required_flags, const char *error_code) {
     auto pool = GetCommandPoolNode(dev_data, cb_node->createInfo.commandPool);
     if (pool) {
         VkQueueFlags queue_flags = dev_data->phys_dev_properties.queue_family_properties[pool->queueFamilyIndex].queueFlags;
@@ -1889,7 +2059,7 @@ BASE_NODE *GetStateStructPtrFromObject(layer_data *dev_data, VK_OBJECT object_st
 //  Add object_binding to cmd buffer
 //  Add cb_binding to object
 static void addCommandBufferBinding(std::unordered_set<GLOBAL_CB_NODE *> *cb_bindings, VK_OBJECT obj, GLOBAL_CB_NODE *cb_node) {
-    cb_bindings->insert(cb_node);
+    InsertCommandBufferBinding(cb_bindings, cb_node);
     cb_node->object_bindings.insert(obj);
 }
 // For a given object, if cb_node is in that objects cb_bindings, remove cb_node
@@ -1897,8 +2067,30 @@ static void removeCommandBufferBinding(layer_data *dev_data, VK_OBJECT const *ob
     BASE_NODE *base_obj = GetStateStructPtrFromObject(dev_data, *object);
     if (base_obj) base_obj->cb_bindings.erase(cb_node);
 }
+// The CB's unordered containers draw their nodes from its node_recycler. Everything else is set up by
+//  ResetCommandBufferState.
+GLOBAL_CB_NODE::GLOBAL_CB_NODE()
+    : framebuffers(&node_recycler),
+      object_bindings(&node_recycler),
+      qfo_transfer_buffer_barriers(&node_recycler),
+      qfo_transfer_image_barriers(&node_recycler),
+      waitedEvents(&node_recycler),
+      waitedEventsBeforeQueryReset(&node_recycler),
+      queryToStateMap(&node_recycler),
+      activeQueries(&node_recycler),
+      startedQueries(&node_recycler),
+      imageLayoutMap(&node_recycler),
+      eventToStageMap(&node_recycler),
+      updateImages(&node_recycler),
+      updateBuffers(&node_recycler),
+      linkedCommandBuffers(&node_recycler),
+      memObjs(&node_recycler),
+      validated_descriptor_sets(&node_recycler) {}
+
 // Reset the command buffer state
-//  Maintain the createInfo and set state to CB_NEW, but clear all other state
+//  Maintain the createInfo and set state to CB_NEW, but clear all other state. Containers are cleared rather than replaced,
+//  so their nodes go back to the CB's node_recycler and their bucket arrays and vector capacity carry over to the next
+//  recording.
 static void ResetCommandBufferState(layer_data *dev_data, const VkCommandBuffer cb) {
     GLOBAL_CB_NODE *pCB = dev_data->commandBufferMap[cb];
     if (pCB) {
@@ -1961,6 +2153,7 @@ static void ResetCommandBufferState(layer_data *dev_data, const VkCommandBuffer
             removeCommandBufferBinding(dev_data, &obj, pCB);
         }
         pCB->object_bindings.clear();
+        pCB->in_use_nodes.clear();
         // Remove this cmdBuffer's reference from each FrameBuffer's CB ref list
         for (auto framebuffer : pCB->framebuffers) {
             auto fb_state = GetFramebufferState(dev_data, framebuffer);
@@ -2020,7 +2213,7 @@ CBStatusFlags MakeStaticStateMask(VkPipelineDynamicStateCreateInfo const *ds) {
 
 // Flags validation error if the associated call is made inside a render pass. The apiName routine should ONLY be called outside a
 // render pass.
-bool insideRenderPass(const layer_data *dev_data, const GLOBAL_CB_NODE *pCB, const char *apiName, const std::string &msgCode) {
+bool insideRenderPass(const layer_data *dev_data, const GLOBAL_CB_NODE *pCB, const char *apiName, const char *msgCode) {
     bool inside = false;
     if (pCB->activeRenderPass) {
         inside = log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
@@ -2033,7 +2226,7 @@ bool insideRenderPass(const layer_data *dev_data, const GLOBAL_CB_NODE *pCB, con
 
 // Flags validation error if the associated call is made outside a render pass. The apiName
 // routine should ONLY be called inside a render pass.
-bool outsideRenderPass(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, const char *apiName, const std::string &msgCode) {
+bool outsideRenderPass(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, const char *apiName, const char *msgCode) {
     bool outside = false;
     if (((pCB->createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) && (!pCB->activeRenderPass)) ||
         ((pCB->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) && (!pCB->activeRenderPass) &&
@@ -2049,6 +2242,15 @@ static void init_core_validation(instance_layer_data *instance_data, const VkAll
     layer_debug_report_actions(instance_data->report_data, instance_data->logging_callback, pAllocator, "lunarg_core_validation");
     layer_debug_messenger_actions(instance_data->report_data, instance_data->logging_messenger, pAllocator,
                                   "lunarg_core_validation");
+
+    const char *fine_grained_option = getLayerOption("lunarg_core_validation.fine_grained_locking");
+    instance_data->fine_grained_locking = fine_grained_option && (0 == strcmp(fine_grained_option, "true"));
+    const char *deferred_submit_option = getLayerOption("lunarg_core_validation.deferred_submit_validation");
+    instance_data->deferred_submit_validation = deferred_submit_option && (0 == strcmp(deferred_submit_option, "true"));
+    const char *pipeline_threads_option = getLayerOption("lunarg_core_validation.pipeline_validation_threads");
+    if (pipeline_threads_option && *pipeline_threads_option) {
+        instance_data->pipeline_validation_threads = static_cast<uint32_t>(strtoul(pipeline_threads_option, nullptr, 10));
+    }
 }
 
 // For the given ValidationCheck enum, set all relevant instance disabled flags to true
@@ -2290,6 +2492,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
 
     device_data->instance_data = instance_data;
+    device_data->fine_grained_locking = instance_data->fine_grained_locking;
     // Setup device dispatch table
     layer_init_device_dispatch_table(*pDevice, &device_data->dispatch_table, fpGetDeviceProcAddr);
     device_data->device = *pDevice;
@@ -2339,6 +2542,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         device_data->phys_dev_ext_props.descriptor_indexing_features = *descriptor_indexing_features;
     }
 
+    if (instance_data->deferred_submit_validation) {
+        device_data->deferred_submit_worker.reset(new lock_util::SerialWorker());
+        device_data->deferred_submits = std::make_shared<lock_util::PendingWork>();
+    }
+    if (instance_data->pipeline_validation_threads) {
+        device_data->pipeline_validation_pool.reset(new lock_util::WorkerPool(instance_data->pipeline_validation_threads));
+    }
+
     lock.unlock();
 
     ValidateLayerOrdering(*pCreateInfo);
@@ -2351,6 +2562,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     // TODOSC : Shouldn't need any customization here
     dispatch_key key = get_dispatch_key(device);
     layer_data *dev_data = GetLayerDataPtr(key, layer_data_map);
+    // Finishes any deferred submit validation for this device
+    dev_data->deferred_submit_worker.reset();
+    dev_data->pipeline_validation_pool.reset();
+    ReportSuppressedMessages(dev_data->report_data, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device));
     // Free all the memory
     unique_lock_t lock(global_lock);
     dev_data->pipelineMap.clear();
@@ -2366,12 +2581,12 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->descriptorSetLayoutMap.clear();
     dev_data->imageViewMap.clear();
     dev_data->imageMap.clear();
-    dev_data->imageSubresourceMap.clear();
     dev_data->imageLayoutMap.clear();
     dev_data->bufferViewMap.clear();
     dev_data->bufferMap.clear();
     // Queues persist until device is destroyed
     dev_data->queueMap.clear();
+    dev_data->timeline_queues.clear();
     // Report any memory leaks
     layer_debug_utils_destroy_device(device);
     lock.unlock();
@@ -2410,25 +2625,38 @@ static bool ValidateStageMaskGsTsEnables(layer_data *dev_data, VkPipelineStageFl
     return skip;
 }
 
+// Resolve the bound objects and draw-time buffers of a finished command buffer once, for submit and retire to reuse
+static void BuildInUseNodes(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
+    auto &nodes = cb_node->in_use_nodes;
+    nodes.clear();
+    nodes.reserve(cb_node->object_bindings.size());
+    for (auto obj : cb_node->object_bindings) {
+        auto base_obj = GetStateStructPtrFromObject(dev_data, obj);
+        if (base_obj) nodes.push_back(base_obj);
+    }
+    for (const auto &drawDataElement : cb_node->drawData) {
+        for (auto buffer : drawDataElement.buffers) {
+            auto buffer_state = GetBufferState(dev_data, buffer);
+            if (buffer_state) nodes.push_back(buffer_state);
+        }
+    }
+}
+
 // Loop through bound objects and increment their in_use counts.
 static void IncrementBoundObjects(layer_data *dev_data, GLOBAL_CB_NODE const *cb_node) {
+    if (cb_node->state == CB_RECORDED) {
+        for (auto base_obj : cb_node->in_use_nodes) {
+            base_obj->in_use.fetch_add(1);
+        }
+        return;
+    }
+    // Invalidated command buffers may reference destroyed objects, so look each one up
     for (auto obj : cb_node->object_bindings) {
         auto base_obj = GetStateStructPtrFromObject(dev_data, obj);
         if (base_obj) {
             base_obj->in_use.fetch_add(1);
         }
     }
-}
-// Track which resources are in-flight by atomically incrementing their "in_use" count
-static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
-    cb_node->submitCount++;
-    cb_node->in_use.fetch_add(1);
-
-    // First Increment for all "generic" objects bound to cmd buffer, followed by special-case objects below
-    IncrementBoundObjects(dev_data, cb_node);
-    // TODO : We should be able to remove the NULL look-up checks from the code below as long as
-    //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
-    //  should then be flagged prior to calling this function
     for (auto drawDataElement : cb_node->drawData) {
         for (auto buffer : drawDataElement.buffers) {
             auto buffer_state = GetBufferState(dev_data, buffer);
@@ -2437,55 +2665,73 @@ static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
             }
         }
     }
+}
+// Track which resources are in-flight by atomically incrementing their "in_use" count
+static void incrementResources(layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
+    cb_node->submitCount++;
+    cb_node->in_use.fetch_add(1);
+
+    // First Increment for all "generic" objects and draw-time buffers bound to cmd buffer, followed by special-case objects below
+    IncrementBoundObjects(dev_data, cb_node);
     for (auto event : cb_node->writeEventsBeforeWait) {
         auto event_state = GetEventNode(dev_data, event);
         if (event_state) event_state->write_in_use++;
     }
 }
 
+// The submission on queue that completes at sequence number seq, or nullptr if it has been retired (or never existed)
+static CB_SUBMISSION *GetSubmission(QUEUE_STATE *queue, uint64_t seq) {
+    if ((seq <= queue->seq) || (seq > queue->seq + queue->submissions.size())) return nullptr;
+    return &queue->submissions[size_t(seq - queue->seq - 1)];
+}
+
+// Fill in the vector clock of the submission just recorded at the back of queue, once its semaphore waits are known. It is the
+// element-wise max of the previous submission's clock and, per wait, the waited-for sequence number and its signaler's clock,
+// so it covers everything the submission transitively depends on. A signaler that has already been retired took its own
+// dependencies with it, so its sequence number alone is enough.
+static void StampSubmissionClock(layer_data *dev_data, QUEUE_STATE *queue) {
+    CB_SUBMISSION &submission = queue->submissions.back();
+    auto &clock = submission.clock;
+    clock.clear();
+    clock.resize(dev_data->timeline_queues.size(), 0);
+    auto merge = [&clock](const CB_SUBMISSION *other) {
+        if (!other) return;
+        for (size_t i = 0; i < other->clock.size(); ++i) {
+            if (clock[i] < other->clock[i]) clock[i] = other->clock[i];
+        }
+    };
+
+    const uint64_t seq = queue->seq + queue->submissions.size();
+    merge(GetSubmission(queue, seq - 1));
+    for (const auto &wait : submission.waitSemaphores) {
+        auto other_queue = GetQueueState(dev_data, wait.queue);
+        if (!other_queue) continue;
+        auto &entry = clock[other_queue->timeline_index];
+        if (entry < wait.seq) entry = wait.seq;
+        merge(GetSubmission(other_queue, wait.seq));
+    }
+    clock[queue->timeline_index] = seq;
+}
+
 // Note: This function assumes that the global lock is held by the calling thread.
-// For the given queue, verify the queue state up to the given seq number.
+// For the given queue, verify the queue state up to the given seq number, along with everything on other queues it waits for.
 // Currently the only check is to make sure that if there are events to be waited on prior to
 //  a QueryReset, make sure that all such events have been signalled.
 static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_queue, uint64_t initial_seq) {
     bool skip = false;
 
-    // sequence number we want to validate up to, per queue
-    std::unordered_map<QUEUE_STATE *, uint64_t> target_seqs{{initial_queue, initial_seq}};
-    // sequence number we've completed validation for, per queue
-    std::unordered_map<QUEUE_STATE *, uint64_t> done_seqs;
-    std::vector<QUEUE_STATE *> worklist{initial_queue};
-
-    while (worklist.size()) {
-        auto queue = worklist.back();
-        worklist.pop_back();
-
-        auto target_seq = target_seqs[queue];
-        auto seq = std::max(done_seqs[queue], queue->seq);
-        auto sub_it = queue->submissions.begin() + int(seq - queue->seq);  // seq >= queue->seq
-
-        for (; seq < target_seq; ++sub_it, ++seq) {
-            for (auto &wait : sub_it->waitSemaphores) {
-                auto other_queue = GetQueueState(dev_data, wait.queue);
+    // The target submission's clock says how far along every queue this has to look
+    const CB_SUBMISSION *target = GetSubmission(initial_queue, initial_seq);
+    if (!target) return false;
 
-                if (other_queue == queue) continue;  // semaphores /always/ point backwards, so no point here.
-
-                auto other_target_seq = std::max(target_seqs[other_queue], wait.seq);
-                auto other_done_seq = std::max(done_seqs[other_queue], other_queue->seq);
-
-                // if this wait is for another queue, and covers new sequence
-                // numbers beyond what we've already validated, mark the new
-                // target seq and (possibly-re)add the queue to the worklist.
-                if (other_done_seq < other_target_seq) {
-                    target_seqs[other_queue] = other_target_seq;
-                    worklist.push_back(other_queue);
-                }
-            }
-
-            for (auto cb : sub_it->cbs) {
+    for (size_t queue_index = 0; queue_index < target->clock.size(); ++queue_index) {
+        QUEUE_STATE *queue = dev_data->timeline_queues[queue_index];
+        for (uint64_t seq = queue->seq; seq < target->clock[queue_index]; ++seq) {
+            const CB_SUBMISSION &submission = queue->submissions[size_t(seq - queue->seq)];
+            for (auto cb : submission.cbs) {
                 auto cb_node = GetCBNode(dev_data, cb);
                 if (cb_node) {
-                    for (auto queryEventsPair : cb_node->waitedEventsBeforeQueryReset) {
+                    for (const auto &queryEventsPair : cb_node->waitedEventsBeforeQueryReset) {
                         for (auto event : queryEventsPair.second) {
                             if (dev_data->eventMap[event].needsSignaled) {
                                 skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
@@ -2500,9 +2746,6 @@ static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_que
                 }
             }
         }
-
-        // finally mark the point we've now validated this queue to.
-        done_seqs[queue] = seq;
     }
 
     return skip;
@@ -2517,8 +2760,14 @@ static bool VerifyQueueStateToFence(layer_data *dev_data, VkFence fence) {
     return false;
 }
 
-// Decrement in-use count for objects bound to command buffer
+// Decrement in-use count for objects and draw-time buffers bound to command buffer
 static void DecrementBoundResources(layer_data *dev_data, GLOBAL_CB_NODE const *cb_node) {
+    if (cb_node->state == CB_RECORDED) {
+        for (auto base_obj : cb_node->in_use_nodes) {
+            base_obj->in_use.fetch_sub(1);
+        }
+        return;
+    }
     BASE_NODE *base_obj = nullptr;
     for (auto obj : cb_node->object_bindings) {
         base_obj = GetStateStructPtrFromObject(dev_data, obj);
@@ -2526,11 +2775,18 @@ static void DecrementBoundResources(layer_data *dev_data, GLOBAL_CB_NODE const *
             base_obj->in_use.fetch_sub(1);
         }
     }
+    for (auto drawDataElement : cb_node->drawData) {
+        for (auto buffer : drawDataElement.buffers) {
+            auto buffer_state = GetBufferState(dev_data, buffer);
+            if (buffer_state) {
+                buffer_state->in_use.fetch_sub(1);
+            }
+        }
+    }
 }
 
-static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_t seq) {
-    std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
-
+// Retire the submissions on pQueue through seq, without regard to what they wait for on other queues
+static void RetireSubmissionsOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_t seq) {
     // Roll this queue forward, one submission at a time.
     while (pQueue->seq < seq) {
         auto &submission = pQueue->submissions.front();
@@ -2540,8 +2796,6 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
             }
-            auto &lastSeq = otherQueueSeqs[wait.queue];
-            lastSeq = std::max(lastSeq, wait.seq);
         }
 
         for (auto &semaphore : submission.signalSemaphores) {
@@ -2565,14 +2819,6 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
             }
             // First perform decrement on general case bound objects
             DecrementBoundResources(dev_data, cb_node);
-            for (auto drawDataElement : cb_node->drawData) {
-                for (auto buffer : drawDataElement.buffers) {
-                    auto buffer_state = GetBufferState(dev_data, buffer);
-                    if (buffer_state) {
-                        buffer_state->in_use.fetch_sub(1);
-                    }
-                }
-            }
             for (auto event : cb_node->writeEventsBeforeWait) {
                 auto eventNode = dev_data->eventMap.find(event);
                 if (eventNode != dev_data->eventMap.end()) {
@@ -2597,11 +2843,20 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
         pQueue->submissions.pop_front();
         pQueue->seq++;
     }
+}
+
+// Retire the submissions on pQueue through seq and everything they wait for. The last one's clock gives how far every other
+// queue must have got, so that is a single pass over the queues.
+static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_t seq) {
+    const CB_SUBMISSION *target = GetSubmission(pQueue, seq);
+    if (!target) return;
 
-    // Roll other queues forward to the highest seq we saw a wait for
-    for (auto qs : otherQueueSeqs) {
-        RetireWorkOnQueue(dev_data, GetQueueState(dev_data, qs.first), qs.second);
+    // Other queues first, as retiring pQueue's own submissions recycles the target's record
+    for (size_t queue_index = 0; queue_index < target->clock.size(); ++queue_index) {
+        if (queue_index == pQueue->timeline_index) continue;
+        RetireSubmissionsOnQueue(dev_data, dev_data->timeline_queues[queue_index], target->clock[queue_index]);
     }
+    RetireSubmissionsOnQueue(dev_data, pQueue, seq);
 }
 
 // Submit a fence to a queue, delimiting previous fences and previous untracked
@@ -2823,8 +3078,8 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
                 // If no submissions, but just dropping a fence on the end of the queue,
                 // record an empty submission with just the fence, so we can determine
                 // its completion.
-                pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::vector<SEMAPHORE_WAIT>(),
-                                                 std::vector<VkSemaphore>(), std::vector<VkSemaphore>(), fence);
+                pQueue->submissions.emplace_back().fence = fence;
+                StampSubmissionClock(dev_data, pQueue);
             }
         } else {
             // Retire work up until this fence early, we will not see the wait that corresponds to this signal
@@ -2843,11 +3098,12 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
 
     // Now process each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        std::vector<VkCommandBuffer> cbs;
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        vector<SEMAPHORE_WAIT> semaphore_waits;
-        vector<VkSemaphore> semaphore_signals;
-        vector<VkSemaphore> semaphore_externals;
+        CB_SUBMISSION &submission = pQueue->submissions.emplace_back();
+        auto &cbs = submission.cbs;
+        auto &semaphore_waits = submission.waitSemaphores;
+        auto &semaphore_signals = submission.signalSemaphores;
+        auto &semaphore_externals = submission.externalSemaphores;
         for (uint32_t i = 0; i < submit->waitSemaphoreCount; ++i) {
             VkSemaphore semaphore = submit->pWaitSemaphores[i];
             auto pSemaphore = GetSemaphoreNode(dev_data, semaphore);
@@ -2874,13 +3130,13 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
             if (pSemaphore) {
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     pSemaphore->signaler.first = queue;
-                    pSemaphore->signaler.second = pQueue->seq + pQueue->submissions.size() + 1;
+                    pSemaphore->signaler.second = pQueue->seq + pQueue->submissions.size();
                     pSemaphore->signaled = true;
                     pSemaphore->in_use.fetch_add(1);
                     semaphore_signals.push_back(semaphore);
                 } else {
                     // Retire work up until this submit early, we will not see the wait that corresponds to this signal
-                    early_retire_seq = std::max(early_retire_seq, pQueue->seq + pQueue->submissions.size() + 1);
+                    early_retire_seq = std::max(early_retire_seq, pQueue->seq + pQueue->submissions.size());
                     if (!dev_data->external_sync_warning) {
                         dev_data->external_sync_warning = true;
                         log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,
@@ -2908,8 +3164,8 @@ static void PostCallRecordQueueSubmit(layer_data *dev_data, VkQueue queue, uint3
                 RecordQueuedQFOTransfers(dev_data, cb_node);
             }
         }
-        pQueue->submissions.emplace_back(cbs, semaphore_waits, semaphore_signals, semaphore_externals,
-                                         submit_idx == submitCount - 1 ? fence : VK_NULL_HANDLE);
+        submission.fence = submit_idx == submitCount - 1 ? fence : VK_NULL_HANDLE;
+        StampSubmissionClock(dev_data, pQueue);
     }
 
     if (early_retire_seq) {
@@ -2929,7 +3185,7 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
     unordered_set<VkSemaphore> unsignaled_semaphores;
     unordered_set<VkSemaphore> internal_semaphores;
     vector<VkCommandBuffer> current_cmds;
-    unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> localImageLayoutMap;
+    ImageLayoutMap localImageLayoutMap;
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
@@ -3005,8 +3261,52 @@ static bool PreCallValidateQueueSubmit(layer_data *dev_data, VkQueue queue, uint
     return skip;
 }
 
+// Validate and record a submission on the device's deferred submit worker, in submission order. Errors reach the application
+// through the usual callbacks, followed by a message naming the submission's queue sequence number, since the batch has already
+// gone to the driver by then.
+static void DeferQueueSubmitValidation(layer_data *dev_data, VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                       VkFence fence) {
+    // The application may reuse the submit info arrays as soon as vkQueueSubmit returns
+    auto submits = std::make_shared<std::vector<safe_VkSubmitInfo>>();
+    submits->reserve(submitCount);
+    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+        submits->emplace_back(&pSubmits[submit_idx]);
+    }
+
+    dev_data->deferred_submits->Add();
+    dev_data->deferred_submit_worker->Post([dev_data, queue, submits, fence]() {
+        std::vector<VkSubmitInfo> submit_infos;
+        submit_infos.reserve(submits->size());
+        for (auto &submit : *submits) {
+            submit_infos.push_back(*submit.ptr());
+        }
+        const uint32_t submit_count = static_cast<uint32_t>(submit_infos.size());
+        const VkSubmitInfo *submit_data = submit_infos.empty() ? nullptr : submit_infos.data();
+
+        global_lock.lock_deferred_submit();
+        unique_lock_t lock(global_lock, std::adopt_lock);
+        auto queue_state = GetQueueState(dev_data, queue);
+        const uint64_t seq = queue_state ? queue_state->seq + queue_state->submissions.size() + 1 : 0;
+        bool skip = PreCallValidateQueueSubmit(dev_data, queue, submit_count, submit_data, fence);
+        PostCallRecordQueueSubmit(dev_data, queue, submit_count, submit_data, fence);
+        if (skip) {
+            log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUEUE_EXT,
+                    HandleToUint64(queue), DRAWSTATE_DEFERRED_SUBMIT_VALIDATION,
+                    "vkQueueSubmit(): The preceding errors were found by deferred validation of submission %" PRIu64
+                    " on queue 0x%" PRIx64 ", which had already been passed to the driver.",
+                    seq, HandleToUint64(queue));
+        }
+        lock.unlock();
+        dev_data->deferred_submits->Done();
+    });
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+    if (dev_data->deferred_submit_worker) {
+        DeferQueueSubmitValidation(dev_data, queue, submitCount, pSubmits, fence);
+        return dev_data->dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    }
     unique_lock_t lock(global_lock);
 
     bool skip = PreCallValidateQueueSubmit(dev_data, queue, submitCount, pSubmits, fence);
@@ -3339,7 +3639,9 @@ static void PostCallRecordGetDeviceQueue(layer_data *dev_data, uint32_t q_family
         QUEUE_STATE *queue_state = &dev_data->queueMap[queue];
         queue_state->queue = queue;
         queue_state->queueFamilyIndex = q_family_index;
+        queue_state->timeline_index = static_cast<uint32_t>(dev_data->timeline_queues.size());
         queue_state->seq = 0;
+        dev_data->timeline_queues.push_back(queue_state);
     }
 }
 
@@ -3712,17 +4014,15 @@ static bool ValidateInsertMemoryRange(layer_data const *dev_data, uint64_t handl
     range.start = memoryOffset;
     range.size = memRequirements.size;
     range.end = memoryOffset + memRequirements.size - 1;
-    range.aliases.clear();
 
-    // Check for aliasing problems.
-    for (auto &obj_range_pair : mem_info->bound_ranges) {
-        auto check_range = &obj_range_pair.second;
+    // Check for aliasing problems. Only ranges starting near this one can overlap it, even after granularity padding.
+    auto granularity = dev_data->phys_dev_properties.properties.limits.bufferImageGranularity;
+    mem_info->ForEachBoundRangeNear(range.start, range.end, granularity, [&](MEMORY_RANGE const *check_range) {
         bool intersection_error = false;
         if (rangesIntersect(dev_data, &range, check_range, &intersection_error, false)) {
             skip |= intersection_error;
-            range.aliases.insert(check_range);
         }
-    }
+    });
 
     if (memoryOffset >= mem_info->alloc_info.allocationSize) {
         std::string error_code =
@@ -3738,16 +4038,28 @@ static bool ValidateInsertMemoryRange(layer_data const *dev_data, uint64_t handl
     return skip;
 }
 
+// Drop the start-ordered index entry for a range that is about to be replaced or erased
+static void UnindexMemoryRange(DEVICE_MEM_INFO *mem_info, MEMORY_RANGE *range) {
+    auto candidates = mem_info->bound_ranges_by_start.equal_range(range->start);
+    for (auto it = candidates.first; it != candidates.second; ++it) {
+        if (it->second == range) {
+            mem_info->bound_ranges_by_start.erase(it);
+            return;
+        }
+    }
+}
+
 // Object with given handle is being bound to memory w/ given mem_info struct.
-//  Track the newly bound memory range with given memoryOffset
-//  Also scan any previous ranges, track aliased ranges with new range, and flag an error if a linear
-//  and non-linear range incorrectly overlap.
-// Return true if an error is flagged and the user callback returns "true", otherwise false
+//  Track the newly bound memory range with given memoryOffset, indexed by its start so later
+//  binds and maps can find overlapping ranges without scanning every range in the allocation.
 // is_image indicates an image object, otherwise handle is for a buffer
 // is_linear indicates a buffer or linear image
 static void InsertMemoryRange(layer_data const *dev_data, uint64_t handle, DEVICE_MEM_INFO *mem_info, VkDeviceSize memoryOffset,
                               VkMemoryRequirements memRequirements, bool is_image, bool is_linear) {
-    MEMORY_RANGE range;
+    auto existing = mem_info->bound_ranges.find(handle);
+    if (existing != mem_info->bound_ranges.end()) UnindexMemoryRange(mem_info, &existing->second);
+
+    auto &range = mem_info->bound_ranges[handle];
 
     range.image = is_image;
     range.handle = handle;
@@ -3756,23 +4068,8 @@ static void InsertMemoryRange(layer_data const *dev_data, uint64_t handle, DEVIC
     range.start = memoryOffset;
     range.size = memRequirements.size;
     range.end = memoryOffset + memRequirements.size - 1;
-    range.aliases.clear();
-    // Update Memory aliasing
-    // Save aliased ranges so we can copy into final map entry below. Can't do it in loop b/c we don't yet have final ptr. If we
-    // inserted into map before loop to get the final ptr, then we may enter loop when not needed & we check range against itself
-    std::unordered_set<MEMORY_RANGE *> tmp_alias_ranges;
-    for (auto &obj_range_pair : mem_info->bound_ranges) {
-        auto check_range = &obj_range_pair.second;
-        bool intersection_error = false;
-        if (rangesIntersect(dev_data, &range, check_range, &intersection_error, true)) {
-            range.aliases.insert(check_range);
-            tmp_alias_ranges.insert(check_range);
-        }
-    }
-    mem_info->bound_ranges[handle] = std::move(range);
-    for (auto tmp_range : tmp_alias_ranges) {
-        tmp_range->aliases.insert(&mem_info->bound_ranges[handle]);
-    }
+    mem_info->bound_ranges_by_start.emplace(range.start, &range);
+    mem_info->max_bound_range_size = std::max(mem_info->max_bound_range_size, range.size);
     if (is_image)
         mem_info->bound_images.insert(handle);
     else
@@ -3803,12 +4100,11 @@ static void InsertBufferMemoryRange(layer_data const *dev_data, VkBuffer buffer,
 //  This function will also remove the handle-to-index mapping from the appropriate
 //  map and clean up any aliases for range being removed.
 static void RemoveMemoryRange(uint64_t handle, DEVICE_MEM_INFO *mem_info, bool is_image) {
-    auto erase_range = &mem_info->bound_ranges[handle];
-    for (auto alias_range : erase_range->aliases) {
-        alias_range->aliases.erase(erase_range);
+    auto erase_range = mem_info->bound_ranges.find(handle);
+    if (erase_range != mem_info->bound_ranges.end()) {
+        UnindexMemoryRange(mem_info, &erase_range->second);
+        mem_info->bound_ranges.erase(erase_range);
     }
-    erase_range->aliases.clear();
-    mem_info->bound_ranges.erase(handle);
     if (is_image) {
         mem_info->bound_images.erase(handle);
     } else {
@@ -4078,11 +4374,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(VkDevice device, uint32_t bi
 
 static void PostCallRecordGetBufferMemoryRequirements(layer_data *dev_data, VkBuffer buffer,
                                                       VkMemoryRequirements *pMemoryRequirements) {
-    BUFFER_STATE *buffer_state;
-    {
-        unique_lock_t lock(global_lock);
-        buffer_state = GetBufferState(dev_data, buffer);
-    }
+    // The pin keeps the state object alive against a racing vkDestroyBuffer; requirements are only written here
+    lock_util::EpochGuard guard;
+    BUFFER_STATE *buffer_state = GetBufferState(dev_data, buffer);
     if (buffer_state) {
         buffer_state->requirements = *pMemoryRequirements;
         buffer_state->memory_requirements_checked = true;
@@ -4112,11 +4406,9 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(VkDevice device, cons
 
 static void PostCallRecordGetImageMemoryRequirements(layer_data *dev_data, VkImage image,
                                                      VkMemoryRequirements *pMemoryRequirements) {
-    IMAGE_STATE *image_state;
-    {
-        unique_lock_t lock(global_lock);
-        image_state = GetImageState(dev_data, image);
-    }
+    // The pin keeps the state object alive against a racing vkDestroyImage; requirements are only written here
+    lock_util::EpochGuard guard;
+    IMAGE_STATE *image_state = GetImageState(dev_data, image);
     if (image_state) {
         image_state->requirements = *pMemoryRequirements;
         image_state->memory_requirements_checked = true;
@@ -4390,8 +4682,14 @@ static void PreCallRecordDestroyDescriptorPool(layer_data *dev_data, VkDescripto
         for (auto ds : desc_pool_state->sets) {
             freeDescriptorSet(dev_data, ds);
         }
-        dev_data->descriptorPoolMap.erase(descriptorPool);
-        delete desc_pool_state;
+        const auto &stats = desc_pool_state->set_allocator.GetStats();
+        log_msg(dev_data->report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT,
+                HandleToUint64(descriptorPool), DRAWSTATE_DESCRIPTOR_POOL_STATS,
+                "Descriptor pool 0x%" PRIx64 " set storage: %" PRIu64 " sets allocated (%" PRIu64
+                " from recycled storage), peak %" PRIu64 " live, %" PRIu64 " chunks.",
+                HandleToUint64(descriptorPool), stats.allocations, stats.reused, stats.peak_live, stats.chunks);
+        // Deleted, together with its retired sets, once no lock-free reader can still hold the pool
+        dev_data->descriptorPoolMap.erase(descriptorPool, [desc_pool_state]() { delete desc_pool_state; });
     }
 }
 
@@ -4447,9 +4745,8 @@ static void FreeCommandBufferStates(layer_data *dev_data, COMMAND_POOL_NODE *poo
             // TODO: fix this, it's insane.
             ResetCommandBufferState(dev_data, cb_state->commandBuffer);
             // Remove the cb_state's references from layer_data and COMMAND_POOL_NODE
-            dev_data->commandBufferMap.erase(cb_state->commandBuffer);
             pool_state->commandBuffers.erase(command_buffers[i]);
-            delete cb_state;
+            dev_data->commandBufferMap.erase(cb_state->commandBuffer, [cb_state]() { delete cb_state; });
         }
     }
 }
@@ -4614,7 +4911,8 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount,
 }
 
 // For given cb_nodes, invalidate them and track object causing invalidation
-void invalidateCommandBuffers(const layer_data *dev_data, std::unordered_set<GLOBAL_CB_NODE *> const &cb_nodes, VK_OBJECT obj) {
+template <typename CBSet>
+static void InvalidateCommandBufferSet(const layer_data *dev_data, CBSet const &cb_nodes, VK_OBJECT obj) {
     for (auto cb_node : cb_nodes) {
         if (cb_node->state == CB_RECORDING) {
             log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
@@ -4629,11 +4927,19 @@ void invalidateCommandBuffers(const layer_data *dev_data, std::unordered_set<GLO
 
         // if secondary, then propagate the invalidation to the primaries that will call us.
         if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
-            invalidateCommandBuffers(dev_data, cb_node->linkedCommandBuffers, obj);
+            InvalidateCommandBufferSet(dev_data, cb_node->linkedCommandBuffers, obj);
         }
     }
 }
 
+void invalidateCommandBuffers(const layer_data *dev_data, std::unordered_set<GLOBAL_CB_NODE *> const &cb_nodes, VK_OBJECT obj) {
+    InvalidateCommandBufferSet(dev_data, cb_nodes, obj);
+}
+
+void invalidateCommandBuffers(const layer_data *dev_data, RecyclingUnorderedSet<GLOBAL_CB_NODE *> const &cb_nodes, VK_OBJECT obj) {
+    InvalidateCommandBufferSet(dev_data, cb_nodes, obj);
+}
+
 static bool PreCallValidateDestroyFramebuffer(layer_data *dev_data, VkFramebuffer framebuffer,
                                               FRAMEBUFFER_STATE **framebuffer_state, VK_OBJECT *obj_struct) {
     *framebuffer_state = GetFramebufferState(dev_data, framebuffer);
@@ -4764,31 +5070,25 @@ const VkPhysicalDeviceProperties *GetPhysicalDeviceProperties(core_validation::l
 
 const CHECK_DISABLED *GetDisables(core_validation::layer_data *device_data) { return &device_data->instance_data->disabled; }
 
-std::unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *device_data) {
+HandleMap<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *device_data) {
     return &device_data->imageMap;
 }
 
-std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *GetImageSubresourceMap(core_validation::layer_data *device_data) {
-    return &device_data->imageSubresourceMap;
-}
-
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> *GetImageLayoutMap(layer_data *device_data) {
-    return &device_data->imageLayoutMap;
-}
+ImageLayoutMap *GetImageLayoutMap(layer_data *device_data) { return &device_data->imageLayoutMap; }
 
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> const *GetImageLayoutMap(layer_data const *device_data) {
+ImageLayoutMap const *GetImageLayoutMap(layer_data const *device_data) {
     return &device_data->imageLayoutMap;
 }
 
-std::unordered_map<VkBuffer, std::unique_ptr<BUFFER_STATE>> *GetBufferMap(layer_data *device_data) {
+HandleMap<VkBuffer, std::unique_ptr<BUFFER_STATE>> *GetBufferMap(layer_data *device_data) {
     return &device_data->bufferMap;
 }
 
-std::unordered_map<VkBufferView, std::unique_ptr<BUFFER_VIEW_STATE>> *GetBufferViewMap(layer_data *device_data) {
+HandleMap<VkBufferView, std::unique_ptr<BUFFER_VIEW_STATE>> *GetBufferViewMap(layer_data *device_data) {
     return &device_data->bufferViewMap;
 }
 
-std::unordered_map<VkImageView, std::unique_ptr<IMAGE_VIEW_STATE>> *GetImageViewMap(layer_data *device_data) {
+HandleMap<VkImageView, std::unique_ptr<IMAGE_VIEW_STATE>> *GetImageViewMap(layer_data *device_data) {
     return &device_data->imageViewMap;
 }
 
@@ -4892,6 +5192,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateValidationCacheEXT(VkDevice device, const V
 
 VKAPI_ATTR void VKAPI_CALL DestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache,
                                                      const VkAllocationCallbacks *pAllocator) {
+    layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    {
+        // Shader modules outlive the cache they were created with; stop pipelines from recording into it
+        lock_guard_t lock(global_lock);
+        for (auto &module : dev_data->shaderModuleMap) {
+            if (module.second->validation_cache == validationCache) module.second->validation_cache = VK_NULL_HANDLE;
+        }
+    }
     delete (ValidationCache *)validationCache;
 }
 
@@ -4946,6 +5254,31 @@ void set_pipeline_state(PIPELINE_STATE *pPipe) {
     }
 }
 
+// Calls validate(i) for each pipeline of a vkCreate*Pipelines batch, spread over the device's pipeline validation pool if it has
+// one. Each pipeline's messages are then reported in pipeline order, so the output doesn't depend on thread scheduling. validate
+// may run with global_lock released, so every thread running it pins the epoch for the state it looks up.
+static bool ValidatePipelineBatch(layer_data *dev_data, uint32_t count, const std::function<bool(uint32_t)> &validate) {
+    bool skip = false;
+    if (!dev_data->pipeline_validation_pool || (count < 2)) {
+        lock_util::EpochGuard guard;
+        for (uint32_t i = 0; i < count; i++) skip |= validate(i);
+        return skip;
+    }
+
+    vector<LogMessageBuffer> messages(count);
+    std::unique_ptr<bool[]> pipeline_skip(new bool[count]());
+    dev_data->pipeline_validation_pool->ParallelFor(count, [&](uint32_t i) {
+        lock_util::EpochGuard guard;
+        ScopedLogCapture capture(&messages[i]);
+        pipeline_skip[i] = validate(i);
+    });
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= pipeline_skip[i];
+        skip |= messages[i].Flush();
+    }
+    return skip;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                        const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                        const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
@@ -4958,6 +5291,13 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     pipe_state.reserve(count);
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
 
+    // Pipelines whose shader modules share a validation cache skip unlocked validation if an identical pipeline passed it before
+    vector<uint64_t> cache_hash(count, 0);
+    vector<ValidationCache *> cache(count, nullptr);
+    vector<bool> cache_hit(count, false);
+    // Written from pool threads, so not vector<bool>
+    std::unique_ptr<bool[]> validated_clean(new bool[count]());
+
     uint32_t i = 0;
     unique_lock_t lock(global_lock);
 
@@ -4965,6 +5305,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
         pipe_state.push_back(std::unique_ptr<PIPELINE_STATE>(new PIPELINE_STATE));
         pipe_state[i]->initGraphicsPipeline(&pCreateInfos[i], GetRenderPassStateSharedPtr(dev_data, pCreateInfos[i].renderPass));
         pipe_state[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
+        cache_hash[i] = ValidationCache::MakePipelineHash(dev_data, pipe_state[i].get(), &cache[i]);
+        if (cache_hash[i]) cache_hit[i] = cache[i]->RestorePipeline(cache_hash[i], pipe_state[i].get());
     }
 
     for (i = 0; i < count; i++) {
@@ -4973,9 +5315,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
 
     lock.unlock();
 
-    for (i = 0; i < count; i++) {
-        skip |= ValidatePipelineUnlocked(dev_data, pipe_state, i);
-    }
+    skip |= ValidatePipelineBatch(dev_data, count, [&](uint32_t index) {
+        if (cache_hit[index]) return false;
+        // Only results that produced no message at all are worth replaying, so warnings aren't lost on a cache hit
+        const uint64_t messages_before = LogMsgCount();
+        bool pipeline_skip = ValidatePipelineUnlocked(dev_data, pipe_state, index);
+        validated_clean[index] = (LogMsgCount() == messages_before);
+        return pipeline_skip;
+    });
 
     if (skip) {
         for (i = 0; i < count; i++) {
@@ -4987,9 +5334,19 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     auto result =
         dev_data->dispatch_table.CreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines);
     lock.lock();
+    for (i = 0; i < count; i++) {
+        // The module or the cache (which clears itself from its modules) may have been destroyed while validation ran unlocked
+        if (!cache_hash[i] || !validated_clean[i]) continue;
+        auto module = GetShaderModuleState(dev_data, pCreateInfos[i].pStages[0].module);
+        if (module && (module->validation_cache == VkValidationCacheEXT(cache[i]))) {
+            cache[i]->InsertPipeline(cache_hash[i], pipe_state[i].get());
+        }
+    }
     for (i = 0; i < count; i++) {
         if (pPipelines[i] != VK_NULL_HANDLE) {
             pipe_state[i]->pipeline = pPipelines[i];
+            // Derived state is fixed at creation; computing it here keeps CmdBindPipeline from writing shared pipeline state
+            set_pipeline_state(pipe_state[i].get());
             dev_data->pipelineMap[pPipelines[i]] = std::move(pipe_state[i]);
         }
     }
@@ -5013,11 +5370,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
         pPipeState.push_back(unique_ptr<PIPELINE_STATE>(new PIPELINE_STATE));
         pPipeState[i]->initComputePipeline(&pCreateInfos[i]);
         pPipeState[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
-
-        // TODO: Add Compute Pipeline Verification
-        skip |= validate_compute_pipeline(dev_data, pPipeState[i].get());
     }
 
+    // TODO: Add Compute Pipeline Verification
+    skip |= ValidatePipelineBatch(dev_data, count,
+                                  [&](uint32_t index) { return validate_compute_pipeline(dev_data, pPipeState[index].get()); });
+
     if (skip) {
         for (i = 0; i < count; i++) {
             pPipelines[i] = VK_NULL_HANDLE;
@@ -5803,6 +6161,9 @@ static bool PreCallValidateAllocateDescriptorSets(layer_data *dev_data, const Vk
 static void PostCallRecordAllocateDescriptorSets(layer_data *dev_data, const VkDescriptorSetAllocateInfo *pAllocateInfo,
                                                  VkDescriptorSet *pDescriptorSets,
                                                  const cvdescriptorset::AllocateDescriptorSetsData *common_data) {
+    // Let the new sets reuse the storage of sets freed earlier, where no reader can still hold them
+    DESCRIPTOR_POOL_STATE *pool_state = GetDescriptorPoolState(dev_data, pAllocateInfo->descriptorPool);
+    if (pool_state) pool_state->ReclaimRetiredSets();
     // All the updates are contained in a single cvdescriptorset function
     cvdescriptorset::PerformAllocateDescriptorSets(pAllocateInfo, pDescriptorSets, common_data, &dev_data->descriptorPoolMap,
                                                    &dev_data->setMap, dev_data);
@@ -6071,6 +6432,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
                 (cb_node->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
                 cb_node->activeRenderPass = GetRenderPassState(dev_data, cb_node->beginInfo.pInheritanceInfo->renderPass);
                 cb_node->activeSubpass = cb_node->beginInfo.pInheritanceInfo->subpass;
+                MarkDrawStateDirty(cb_node, DRAW_DIRTY_SUBPASS);
                 cb_node->activeFramebuffer = cb_node->beginInfo.pInheritanceInfo->framebuffer;
                 cb_node->framebuffers.insert(cb_node->beginInfo.pInheritanceInfo->framebuffer);
             }
@@ -6118,6 +6480,7 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
         lock.lock();
         PostCallRecordEndCommandBuffer(dev_data, pCB);
         if (VK_SUCCESS == result) {
+            BuildInUseNodes(dev_data, pCB);
             pCB->state = CB_RECORDED;
         }
         return result;
@@ -6156,7 +6519,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
                                            VkPipeline pipeline) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdBindPipeline()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -6172,7 +6535,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
             cb_state->status |= cb_state->static_status;
         }
         cb_state->lastBound[pipelineBindPoint].pipeline_state = pipe_state;
-        set_pipeline_state(pipe_state);
+        cb_state->lastBound[pipelineBindPoint].draw_validation.MarkDirty(DRAW_DIRTY_PIPELINE);
         addCommandBufferBinding(&pipe_state->cb_bindings, {HandleToUint64(pipeline), kVulkanObjectTypePipeline}, cb_state);
     }
     lock.unlock();
@@ -6183,7 +6546,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
                                           const VkViewport *pViewports) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetViewport()", VK_QUEUE_GRAPHICS_BIT,
@@ -6197,6 +6560,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
         if (!skip) {
             pCB->viewportMask |= ((1u << viewportCount) - 1u) << firstViewport;
             pCB->status |= CBSTATUS_VIEWPORT_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6207,7 +6571,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
                                          const VkRect2D *pScissors) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetScissor()", VK_QUEUE_GRAPHICS_BIT,
@@ -6221,6 +6585,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
         if (!skip) {
             pCB->scissorMask |= ((1u << scissorCount) - 1u) << firstScissor;
             pCB->status |= CBSTATUS_SCISSOR_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6230,7 +6595,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetLineWidth()", VK_QUEUE_GRAPHICS_BIT,
@@ -6244,6 +6609,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
         }
         if (!skip) {
             pCB->status |= CBSTATUS_LINE_WIDTH_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6254,7 +6620,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
                                            float depthBiasSlopeFactor) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetDepthBias()", VK_QUEUE_GRAPHICS_BIT,
@@ -6273,6 +6639,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
         }
         if (!skip) {
             pCB->status |= CBSTATUS_DEPTH_BIAS_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6283,7 +6650,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetBlendConstants()", VK_QUEUE_GRAPHICS_BIT,
@@ -6296,6 +6663,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
         }
         if (!skip) {
             pCB->status |= CBSTATUS_BLEND_CONSTANTS_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6305,7 +6673,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetDepthBounds()", VK_QUEUE_GRAPHICS_BIT,
@@ -6318,6 +6686,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, floa
         }
         if (!skip) {
             pCB->status |= CBSTATUS_DEPTH_BOUNDS_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6328,7 +6697,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
                                                     uint32_t compareMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilCompareMask()", VK_QUEUE_GRAPHICS_BIT,
@@ -6342,6 +6711,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
         }
         if (!skip) {
             pCB->status |= CBSTATUS_STENCIL_READ_MASK_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6351,7 +6721,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilWriteMask()", VK_QUEUE_GRAPHICS_BIT,
@@ -6364,6 +6734,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
         }
         if (!skip) {
             pCB->status |= CBSTATUS_STENCIL_WRITE_MASK_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6373,7 +6744,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdSetStencilReference()", VK_QUEUE_GRAPHICS_BIT,
@@ -6386,6 +6757,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer,
         }
         if (!skip) {
             pCB->status |= CBSTATUS_STENCIL_REFERENCE_SET;
+            MarkDrawStateDirty(pCB, DRAW_DIRTY_DYNAMIC_STATE);
         }
     }
     lock.unlock();
@@ -6420,6 +6792,9 @@ static void UpdateLastBoundDescriptorSets(layer_data *device_data, GLOBAL_CB_NOD
     assert(current_size == dynamic_offsets.size());
     assert(current_size == bound_compat_ids.size());
 
+    // Sets from first_set up are either rebound or possibly disturbed below, those under it only if disturbed
+    last_bound.draw_validation.MarkSetsDirtyFrom(first_set);
+
     // We need this three times in this function, but nowhere else
     auto push_descriptor_cleanup = [&last_bound](const cvdescriptorset::DescriptorSet *ds) -> bool {
         if (ds && ds->IsPushDescriptor()) {
@@ -6458,6 +6833,7 @@ static void UpdateLastBoundDescriptorSets(layer_data *device_data, GLOBAL_CB_NOD
             bound_sets[set_idx] = nullptr;
             dynamic_offsets[set_idx].clear();
             bound_compat_ids[set_idx] = pipe_compat_ids[set_idx];
+            last_bound.draw_validation.MarkSetDirty(set_idx);
         }
     }
 
@@ -6625,7 +7001,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                                  const uint32_t *pDynamicOffsets) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(device_data, commandBuffer);
     GLOBAL_CB_NODE *cb_state = GetCBNode(device_data, commandBuffer);
     assert(cb_state);
     skip = PreCallValidateCmdBindDescriptorSets(device_data, cb_state, pipelineBindPoint, layout, firstSet, setCount,
@@ -6753,7 +7129,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
                                               VkIndexType indexType) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
 
     auto buffer_state = GetBufferState(dev_data, buffer);
     auto cb_node = GetCBNode(dev_data, commandBuffer);
@@ -6779,6 +7155,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
     if (skip) return;
 
     cb_node->status |= CBSTATUS_INDEX_BUFFER_BOUND;
+    MarkDrawStateDirty(cb_node, DRAW_DIRTY_INDEX_BUFFER);
     cb_node->index_buffer_binding.buffer = buffer;
     cb_node->index_buffer_binding.size = buffer_state->createInfo.size;
     cb_node->index_buffer_binding.offset = offset;
@@ -6796,6 +7173,7 @@ void updateResourceTracking(GLOBAL_CB_NODE *pCB, uint32_t firstBinding, uint32_t
     for (uint32_t i = 0; i < bindingCount; ++i) {
         pCB->currentDrawData.buffers[i + firstBinding] = pBuffers[i];
     }
+    MarkDrawStateDirty(pCB, DRAW_DIRTY_VERTEX_BUFFERS);
 }
 
 static inline void updateResourceTrackingOnDraw(GLOBAL_CB_NODE *pCB) { pCB->drawData.push_back(pCB->currentDrawData); }
@@ -6804,7 +7182,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
                                                 const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
 
     auto cb_node = GetCBNode(dev_data, commandBuffer);
     assert(cb_node);
@@ -6829,6 +7207,11 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
 
     if (skip) return;
 
+    // Bind the buffers so that destroying one invalidates this CB, as the submit-time in_use_nodes rely on
+    for (uint32_t i = 0; i < bindingCount; ++i) {
+        auto buffer_state = GetBufferState(dev_data, pBuffers[i]);
+        if (buffer_state) AddCommandBufferBindingBuffer(dev_data, cb_node, buffer_state);
+    }
     updateResourceTracking(cb_node, firstBinding, bindingCount, pBuffers);
 
     lock.unlock();
@@ -6838,7 +7221,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
 // Generic function to handle validation for all CmdDraw* type functions
 static bool ValidateCmdDrawType(layer_data *dev_data, VkCommandBuffer cmd_buffer, bool indexed, VkPipelineBindPoint bind_point,
                                 CMD_TYPE cmd_type, GLOBAL_CB_NODE **cb_state, const char *caller, VkQueueFlags queue_flags,
-                                std::string queue_flag_code, std::string msg_code, std::string const dynamic_state_msg_code) {
+                                const char *queue_flag_code, const char *msg_code, const char *dynamic_state_msg_code) {
     bool skip = false;
     *cb_state = GetCBNode(dev_data, cmd_buffer);
     if (*cb_state) {
@@ -6877,7 +7260,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
                                    uint32_t firstVertex, uint32_t firstInstance) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     bool skip = PreCallValidateCmdDraw(dev_data, commandBuffer, false, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state, "vkCmdDraw()");
     lock.unlock();
     if (!skip) {
@@ -6924,7 +7307,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
                                           uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     bool skip = PreCallValidateCmdDrawIndexed(dev_data, commandBuffer, true, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state,
                                               "vkCmdDrawIndexed()", indexCount, firstIndex);
     lock.unlock();
@@ -6960,7 +7343,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     bool skip = PreCallValidateCmdDrawIndirect(dev_data, commandBuffer, buffer, false, VK_PIPELINE_BIND_POINT_GRAPHICS, &cb_state,
                                                &buffer_state, "vkCmdDrawIndirect()");
     lock.unlock();
@@ -6997,7 +7380,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     bool skip = PreCallValidateCmdDrawIndexedIndirect(dev_data, commandBuffer, buffer, true, VK_PIPELINE_BIND_POINT_GRAPHICS,
                                                       &cb_state, &buffer_state, "vkCmdDrawIndexedIndirect()");
     lock.unlock();
@@ -7022,7 +7405,7 @@ static void PostCallRecordCmdDispatch(layer_data *dev_data, GLOBAL_CB_NODE *cb_s
 VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     bool skip =
         PreCallValidateCmdDispatch(dev_data, commandBuffer, false, VK_PIPELINE_BIND_POINT_COMPUTE, &cb_state, "vkCmdDispatch()");
     lock.unlock();
@@ -7055,7 +7438,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     GLOBAL_CB_NODE *cb_state = nullptr;
     BUFFER_STATE *buffer_state = nullptr;
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     bool skip = PreCallValidateCmdDispatchIndirect(dev_data, commandBuffer, buffer, false, VK_PIPELINE_BIND_POINT_COMPUTE,
                                                    &cb_state, &buffer_state, "vkCmdDispatchIndirect()");
     lock.unlock();
@@ -7325,11 +7708,13 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource *pSubresource,
                                                      VkSubresourceLayout *pLayout) {
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    unique_lock_t lock(global_lock);
-
-    bool skip = PreCallValidateGetImageSubresourceLayout(device_data, image, pSubresource);
+    bool skip;
+    {
+        // Validation only reads immutable create info, so a lock-free lookup is enough
+        lock_util::EpochGuard guard;
+        skip = PreCallValidateGetImageSubresourceLayout(device_data, image, pSubresource);
+    }
     if (!skip) {
-        lock.unlock();
         device_data->dispatch_table.GetImageSubresourceLayout(device, image, pSubresource, pLayout);
     }
 }
@@ -8306,7 +8691,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
                                               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
     bool skip = false;
     layer_data *device_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(device_data, commandBuffer);
     GLOBAL_CB_NODE *cb_state = GetCBNode(device_data, commandBuffer);
     if (cb_state) {
         skip |= PreCallValidateCmdPipelineBarrier(device_data, cb_state, srcStageMask, dstStageMask, dependencyFlags,
@@ -8417,7 +8802,12 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
     lock.lock();
     for (uint32_t i = 0; i < queryCount; i++) {
         QueryObject query = {queryPool, firstQuery + i};
-        cb_state->waitedEventsBeforeQueryReset[query] = cb_state->waitedEvents;
+        // Construct the entry explicitly so that its set also draws from the CB's node_recycler
+        auto &waited_events = cb_state->waitedEventsBeforeQueryReset
+                                  .emplace(std::piecewise_construct, std::forward_as_tuple(query),
+                                           std::forward_as_tuple(cb_state->waitedEvents.get_allocator()))
+                                  .first->second;
+        waited_events = cb_state->waitedEvents;
         cb_state->queryUpdates.emplace_back([=](VkQueue q) { return setQueryState(q, commandBuffer, query, false); });
     }
     addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
@@ -8495,7 +8885,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
                                             uint32_t offset, uint32_t size, const void *pValues) {
     bool skip = false;
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
-    unique_lock_t lock(global_lock);
+    cb_lock_t lock(dev_data, commandBuffer);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdPushConstants()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -8813,9 +9203,8 @@ static bool FindDependency(const uint32_t index, const uint32_t dependent, const
     return false;
 }
 
-static bool CheckDependencyExists(const layer_data *dev_data, const uint32_t subpass,
-                                  const std::vector<uint32_t> &dependent_subpasses, const std::vector<DAGNode> &subpass_to_node,
-                                  bool &skip) {
+static bool CheckDependencyExists(const uint32_t subpass, const std::vector<uint32_t> &dependent_subpasses,
+                                  const std::vector<DAGNode> &subpass_to_node, std::vector<RenderPassDependencyFinding> *findings) {
     bool result = true;
     // Loop through all subpasses that share the same attachment and make sure a dependency exists
     for (uint32_t k = 0; k < dependent_subpasses.size(); ++k) {
@@ -8829,10 +9218,7 @@ static bool CheckDependencyExists(const layer_data *dev_data, const uint32_t sub
             std::unordered_set<uint32_t> processed_nodes;
             if (!(FindDependency(subpass, dependent_subpasses[k], subpass_to_node, processed_nodes) ||
                   FindDependency(dependent_subpasses[k], subpass, subpass_to_node, processed_nodes))) {
-                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                DRAWSTATE_INVALID_RENDERPASS,
-                                "A dependency between subpasses %d and %d must exist but one is not specified.", subpass,
-                                dependent_subpasses[k]);
+                findings->push_back({RenderPassDependencyFinding::kMissingDependency, subpass, dependent_subpasses[k]});
                 result = false;
             }
         }
@@ -8840,8 +9226,9 @@ static bool CheckDependencyExists(const layer_data *dev_data, const uint32_t sub
     return result;
 }
 
-static bool CheckPreserved(const layer_data *dev_data, const VkRenderPassCreateInfo *pCreateInfo, const int index,
-                           const uint32_t attachment, const std::vector<DAGNode> &subpass_to_node, int depth, bool &skip) {
+static bool CheckPreserved(const VkRenderPassCreateInfo *pCreateInfo, const int index, const uint32_t attachment,
+                           const std::vector<DAGNode> &subpass_to_node, int depth,
+                           std::vector<RenderPassDependencyFinding> *findings) {
     const DAGNode &node = subpass_to_node[index];
     // If this node writes to the attachment return true as next nodes need to preserve the attachment.
     const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[index];
@@ -8857,7 +9244,7 @@ static bool CheckPreserved(const layer_data *dev_data, const VkRenderPassCreateI
     bool result = false;
     // Loop through previous nodes and see if any of them write to the attachment.
     for (auto elem : node.prev) {
-        result |= CheckPreserved(dev_data, pCreateInfo, elem, attachment, subpass_to_node, depth + 1, skip);
+        result |= CheckPreserved(pCreateInfo, elem, attachment, subpass_to_node, depth + 1, findings);
     }
     // If the attachment was written to by a previous node than this node needs to preserve it.
     if (result && depth > 0) {
@@ -8869,9 +9256,7 @@ static bool CheckPreserved(const layer_data *dev_data, const VkRenderPassCreateI
             }
         }
         if (!has_preserved) {
-            skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                            DRAWSTATE_INVALID_RENDERPASS,
-                            "Attachment %d is used by a later subpass and must be preserved in subpass %d.", attachment, index);
+            findings->push_back({RenderPassDependencyFinding::kAttachmentNotPreserved, attachment, static_cast<uint32_t>(index)});
         }
     }
     return result;
@@ -8888,64 +9273,122 @@ bool isRegionOverlapping(VkImageSubresourceRange range1, VkImageSubresourceRange
             isRangeOverlapping(range1.baseArrayLayer, range1.layerCount, range2.baseArrayLayer, range2.layerCount));
 }
 
-static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE const *framebuffer,
-                                 RENDER_PASS_STATE const *renderPass) {
-    bool skip = false;
+// Pairs (i < j) of framebuffer attachments that alias: the same view, overlapping subresources of the same image, or
+// overlapping ranges of the same memory. Candidates come from sorting the attachments by view, image and memory binding and
+// sweeping each order, rather than from testing every pair; each candidate is then checked in (i, j) order as before.
+static std::vector<std::vector<uint32_t>> FindOverlappingAttachments(const layer_data *dev_data,
+                                                                      const VkFramebufferCreateInfo *pFramebufferInfo,
+                                                                      uint32_t attachment_count) {
+    struct AttachmentInfo {
+        VkImageView view;
+        const IMAGE_VIEW_STATE *view_state;
+        const IMAGE_STATE *image_state;
+    };
+    std::vector<AttachmentInfo> info(attachment_count);
+    for (uint32_t i = 0; i < attachment_count; ++i) {
+        info[i].view = pFramebufferInfo->pAttachments[i];
+        info[i].view_state = GetImageViewState(dev_data, info[i].view);
+        info[i].image_state = info[i].view_state ? GetImageState(dev_data, info[i].view_state->create_info.image) : nullptr;
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> candidates;
+    auto add_candidate = [&candidates](uint32_t a, uint32_t b) { candidates.emplace_back(std::min(a, b), std::max(a, b)); };
+    // Emit every pair within each run of equal keys
+    auto sweep_equal_runs = [&](std::vector<uint32_t> &order, std::function<bool(uint32_t, uint32_t)> same) {
+        for (size_t begin = 0; begin < order.size();) {
+            size_t end = begin + 1;
+            while (end < order.size() && same(order[begin], order[end])) ++end;
+            for (size_t a = begin; a < end; ++a) {
+                for (size_t b = a + 1; b < end; ++b) add_candidate(order[a], order[b]);
+            }
+            begin = end;
+        }
+    };
+    std::vector<uint32_t> order;
+
+    order.resize(attachment_count);
+    for (uint32_t i = 0; i < attachment_count; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&info](uint32_t a, uint32_t b) { return info[a].view < info[b].view; });
+    sweep_equal_runs(order, [&info](uint32_t a, uint32_t b) { return info[a].view == info[b].view; });
+
+    order.clear();
+    for (uint32_t i = 0; i < attachment_count; ++i) {
+        if (info[i].view_state) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&info](uint32_t a, uint32_t b) {
+        return info[a].view_state->create_info.image < info[b].view_state->create_info.image;
+    });
+    sweep_equal_runs(order, [&info](uint32_t a, uint32_t b) {
+        return info[a].view_state->create_info.image == info[b].view_state->create_info.image;
+    });
+
+    // Memory ranges: sorted by (memory, offset), each range only needs comparing with the ones starting before it ends
+    order.clear();
+    for (uint32_t i = 0; i < attachment_count; ++i) {
+        if (info[i].image_state) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&info](uint32_t a, uint32_t b) {
+        const auto &binding_a = info[a].image_state->binding;
+        const auto &binding_b = info[b].image_state->binding;
+        return (binding_a.mem != binding_b.mem) ? (binding_a.mem < binding_b.mem) : (binding_a.offset < binding_b.offset);
+    });
+    for (size_t a = 0; a < order.size(); ++a) {
+        const auto &binding_a = info[order[a]].image_state->binding;
+        for (size_t b = a + 1; b < order.size(); ++b) {
+            const auto &binding_b = info[order[b]].image_state->binding;
+            if (binding_b.mem != binding_a.mem || binding_b.offset > binding_a.offset + binding_a.size) break;
+            add_candidate(order[a], order[b]);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    std::vector<std::vector<uint32_t>> overlapping_attachments(attachment_count);
+    for (const auto &candidate : candidates) {
+        const uint32_t i = candidate.first, j = candidate.second;
+        bool overlapping = info[i].view == info[j].view;
+        if (!overlapping && info[i].view_state && info[j].view_state) {
+            auto const &view_ci_i = info[i].view_state->create_info;
+            auto const &view_ci_j = info[j].view_state->create_info;
+            overlapping =
+                view_ci_i.image == view_ci_j.image && isRegionOverlapping(view_ci_i.subresourceRange, view_ci_j.subresourceRange);
+            if (!overlapping && info[i].image_state && info[j].image_state) {
+                auto const &binding_i = info[i].image_state->binding;
+                auto const &binding_j = info[j].image_state->binding;
+                overlapping = binding_i.mem == binding_j.mem &&
+                              isRangeOverlapping(binding_i.offset, binding_i.size, binding_j.offset, binding_j.size);
+            }
+        }
+        if (overlapping) {
+            overlapping_attachments[i].push_back(j);
+            overlapping_attachments[j].push_back(i);
+        }
+    }
+    // Keep each list ascending, matching the order of the pairwise scan this replaces
+    for (auto &list : overlapping_attachments) std::sort(list.begin(), list.end());
+    return overlapping_attachments;
+}
+
+// Everything ValidateDependencies reports depends only on the framebuffer and render pass, so it is computed once per pair
+static void FindDependencyProblems(const layer_data *dev_data, FRAMEBUFFER_STATE const *framebuffer,
+                                   RENDER_PASS_STATE const *renderPass, std::vector<RenderPassDependencyFinding> *findings) {
     auto const pFramebufferInfo = framebuffer->createInfo.ptr();
     auto const pCreateInfo = renderPass->createInfo.ptr();
     auto const &subpass_to_node = renderPass->subpassToNode;
     std::vector<std::vector<uint32_t>> output_attachment_to_subpass(pCreateInfo->attachmentCount);
     std::vector<std::vector<uint32_t>> input_attachment_to_subpass(pCreateInfo->attachmentCount);
-    std::vector<std::vector<uint32_t>> overlapping_attachments(pCreateInfo->attachmentCount);
     // Find overlapping attachments
-    for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
-        for (uint32_t j = i + 1; j < pCreateInfo->attachmentCount; ++j) {
-            VkImageView viewi = pFramebufferInfo->pAttachments[i];
-            VkImageView viewj = pFramebufferInfo->pAttachments[j];
-            if (viewi == viewj) {
-                overlapping_attachments[i].push_back(j);
-                overlapping_attachments[j].push_back(i);
-                continue;
-            }
-            auto view_state_i = GetImageViewState(dev_data, viewi);
-            auto view_state_j = GetImageViewState(dev_data, viewj);
-            if (!view_state_i || !view_state_j) {
-                continue;
-            }
-            auto view_ci_i = view_state_i->create_info;
-            auto view_ci_j = view_state_j->create_info;
-            if (view_ci_i.image == view_ci_j.image && isRegionOverlapping(view_ci_i.subresourceRange, view_ci_j.subresourceRange)) {
-                overlapping_attachments[i].push_back(j);
-                overlapping_attachments[j].push_back(i);
-                continue;
-            }
-            auto image_data_i = GetImageState(dev_data, view_ci_i.image);
-            auto image_data_j = GetImageState(dev_data, view_ci_j.image);
-            if (!image_data_i || !image_data_j) {
-                continue;
-            }
-            if (image_data_i->binding.mem == image_data_j->binding.mem &&
-                isRangeOverlapping(image_data_i->binding.offset, image_data_i->binding.size, image_data_j->binding.offset,
-                                   image_data_j->binding.size)) {
-                overlapping_attachments[i].push_back(j);
-                overlapping_attachments[j].push_back(i);
-            }
-        }
-    }
+    std::vector<std::vector<uint32_t>> overlapping_attachments =
+        FindOverlappingAttachments(dev_data, pFramebufferInfo, pCreateInfo->attachmentCount);
     for (uint32_t i = 0; i < overlapping_attachments.size(); ++i) {
         uint32_t attachment = i;
         for (auto other_attachment : overlapping_attachments[i]) {
             if (!(pCreateInfo->pAttachments[attachment].flags & VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT)) {
-                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT,
-                                HandleToUint64(framebuffer->framebuffer), "VUID-VkRenderPassCreateInfo-attachment-00833",
-                                "Attachment %d aliases attachment %d but doesn't set VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT.",
-                                attachment, other_attachment);
+                findings->push_back({RenderPassDependencyFinding::kAttachmentAliasing, attachment, other_attachment});
             }
             if (!(pCreateInfo->pAttachments[other_attachment].flags & VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT)) {
-                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT,
-                                HandleToUint64(framebuffer->framebuffer), "VUID-VkRenderPassCreateInfo-attachment-00833",
-                                "Attachment %d aliases attachment %d but doesn't set VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT.",
-                                other_attachment, attachment);
+                findings->push_back({RenderPassDependencyFinding::kAttachmentAliasing, other_attachment, attachment});
             }
         }
     }
@@ -8979,10 +9422,7 @@ static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE c
             }
 
             if (attachmentIndices.count(attachment)) {
-                skip |=
-                    log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                            DRAWSTATE_INVALID_RENDERPASS,
-                            "Cannot use same attachment (%u) as both color and depth output in same subpass (%u).", attachment, i);
+                findings->push_back({RenderPassDependencyFinding::kColorDepthSameAttachment, attachment, i});
             }
         }
     }
@@ -8993,19 +9433,19 @@ static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE c
         for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
             uint32_t attachment = subpass.pInputAttachments[j].attachment;
             if (attachment == VK_ATTACHMENT_UNUSED) continue;
-            CheckDependencyExists(dev_data, i, output_attachment_to_subpass[attachment], subpass_to_node, skip);
+            CheckDependencyExists(i, output_attachment_to_subpass[attachment], subpass_to_node, findings);
         }
         // If the attachment is an output then all subpasses that use the attachment must have a dependency relationship
         for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
             uint32_t attachment = subpass.pColorAttachments[j].attachment;
             if (attachment == VK_ATTACHMENT_UNUSED) continue;
-            CheckDependencyExists(dev_data, i, output_attachment_to_subpass[attachment], subpass_to_node, skip);
-            CheckDependencyExists(dev_data, i, input_attachment_to_subpass[attachment], subpass_to_node, skip);
+            CheckDependencyExists(i, output_attachment_to_subpass[attachment], subpass_to_node, findings);
+            CheckDependencyExists(i, input_attachment_to_subpass[attachment], subpass_to_node, findings);
         }
         if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment != VK_ATTACHMENT_UNUSED) {
             const uint32_t &attachment = subpass.pDepthStencilAttachment->attachment;
-            CheckDependencyExists(dev_data, i, output_attachment_to_subpass[attachment], subpass_to_node, skip);
-            CheckDependencyExists(dev_data, i, input_attachment_to_subpass[attachment], subpass_to_node, skip);
+            CheckDependencyExists(i, output_attachment_to_subpass[attachment], subpass_to_node, findings);
+            CheckDependencyExists(i, input_attachment_to_subpass[attachment], subpass_to_node, findings);
         }
     }
     // Loop through implicit dependencies, if this pass reads make sure the attachment is preserved for all passes after it was
@@ -9013,7 +9453,56 @@ static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE c
     for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
         const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
         for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
-            CheckPreserved(dev_data, pCreateInfo, i, subpass.pInputAttachments[j].attachment, subpass_to_node, 0, skip);
+            CheckPreserved(pCreateInfo, i, subpass.pInputAttachments[j].attachment, subpass_to_node, 0, findings);
+        }
+    }
+}
+
+
+static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE *framebuffer,
+                                 std::shared_ptr<RENDER_PASS_STATE> const &renderPass) {
+    // Look up (or compute and remember) the findings for this render pass, dropping entries whose render pass is gone
+    auto &cache = framebuffer->dependency_findings;
+    for (auto it = cache.begin(); it != cache.end();) {
+        it = it->first.expired() ? cache.erase(it) : std::next(it);
+    }
+    std::vector<RenderPassDependencyFinding> const *findings = nullptr;
+    for (const auto &entry : cache) {
+        if (entry.first.lock() == renderPass) findings = &entry.second;
+    }
+    if (!findings) {
+        cache.emplace_back(renderPass, std::vector<RenderPassDependencyFinding>());
+        FindDependencyProblems(dev_data, framebuffer, renderPass.get(), &cache.back().second);
+        findings = &cache.back().second;
+    }
+
+    bool skip = false;
+    for (const auto &finding : *findings) {
+        switch (finding.kind) {
+            case RenderPassDependencyFinding::kAttachmentAliasing:
+                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT,
+                                HandleToUint64(framebuffer->framebuffer), "VUID-VkRenderPassCreateInfo-attachment-00833",
+                                "Attachment %d aliases attachment %d but doesn't set VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT.",
+                                finding.first, finding.second);
+                break;
+            case RenderPassDependencyFinding::kColorDepthSameAttachment:
+                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                                DRAWSTATE_INVALID_RENDERPASS,
+                                "Cannot use same attachment (%u) as both color and depth output in same subpass (%u).",
+                                finding.first, finding.second);
+                break;
+            case RenderPassDependencyFinding::kMissingDependency:
+                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                                DRAWSTATE_INVALID_RENDERPASS,
+                                "A dependency between subpasses %d and %d must exist but one is not specified.", finding.first,
+                                finding.second);
+                break;
+            case RenderPassDependencyFinding::kAttachmentNotPreserved:
+                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                                DRAWSTATE_INVALID_RENDERPASS,
+                                "Attachment %d is used by a later subpass and must be preserved in subpass %d.", finding.first,
+                                finding.second);
+                break;
         }
     }
     return skip;
@@ -9060,9 +9549,11 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult res = dev_data->dispatch_table.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
 
     if (res == VK_SUCCESS) {
-        lock_guard_t lock(global_lock);
+        // Reflection reads nothing but the SPIR-V, so build the module before taking the lock and only publish it under it
         unique_ptr<shader_module> new_shader_module(spirv_valid ? new shader_module(pCreateInfo, *pShaderModule)
                                                                 : new shader_module());
+        RecordShaderModuleValidationCache(new_shader_module.get(), pCreateInfo);
+        lock_guard_t lock(global_lock);
         dev_data->shaderModuleMap[*pShaderModule] = std::move(new_shader_module);
     }
     return res;
@@ -9449,7 +9940,8 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
                                                         "VUID-VkRenderPassBeginInfo-renderPass-00904");
             }
             skip |= insideRenderPass(dev_data, cb_node, "vkCmdBeginRenderPass()", "VUID-vkCmdBeginRenderPass-renderpass");
-            skip |= ValidateDependencies(dev_data, framebuffer, render_pass_state);
+            skip |= ValidateDependencies(dev_data, framebuffer,
+                                         GetRenderPassStateSharedPtr(dev_data, pRenderPassBegin->renderPass));
             skip |=
                 validatePrimaryCommandBuffer(dev_data, cb_node, "vkCmdBeginRenderPass()", "VUID-vkCmdBeginRenderPass-bufferlevel");
             skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdBeginRenderPass()", VK_QUEUE_GRAPHICS_BIT,
@@ -9459,6 +9951,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
             // This is a shallow copy as that is all that is needed for now
             cb_node->activeRenderPassBeginInfo = *pRenderPassBegin;
             cb_node->activeSubpass = 0;
+            MarkDrawStateDirty(cb_node, DRAW_DIRTY_SUBPASS);
             cb_node->activeSubpassContents = contents;
             cb_node->framebuffers.insert(pRenderPassBegin->framebuffer);
             // Connect this framebuffer and its children to this cmdBuffer
@@ -9504,6 +9997,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
     if (pCB) {
         lock.lock();
         pCB->activeSubpass++;
+        MarkDrawStateDirty(pCB, DRAW_DIRTY_SUBPASS);
         pCB->activeSubpassContents = contents;
         TransitionSubpassLayouts(dev_data, pCB, pCB->activeRenderPass, pCB->activeSubpass,
                                  GetFramebufferState(dev_data, pCB->activeRenderPassBeginInfo.framebuffer));
@@ -9545,6 +10039,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
         pCB->activeRenderPass = nullptr;
         pCB->activeSubpass = 0;
         pCB->activeFramebuffer = VK_NULL_HANDLE;
+        MarkDrawStateDirty(pCB, DRAW_DIRTY_SUBPASS);
     }
 }
 
@@ -9713,18 +10208,19 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
             }
             // TODO: separate validate from update! This is very tangled.
             // Propagate layout transitions to the primary cmd buffer
-            for (auto ilm_entry : pSubCB->imageLayoutMap) {
-                if (pCB->imageLayoutMap.find(ilm_entry.first) != pCB->imageLayoutMap.end()) {
-                    pCB->imageLayoutMap[ilm_entry.first].layout = ilm_entry.second.layout;
-                } else {
-                    assert(ilm_entry.first.hasSubresource);
-                    IMAGE_CMD_BUF_LAYOUT_NODE node;
-                    if (!FindCmdBufLayout(dev_data, pCB, ilm_entry.first.image, ilm_entry.first.subresource, node)) {
-                        node.initialLayout = ilm_entry.second.initialLayout;
-                    }
-                    node.layout = ilm_entry.second.layout;
-                    SetLayout(dev_data, pCB, ilm_entry.first, node);
+            for (auto const &ilm_entry : pSubCB->imageLayoutMap) {
+                auto primary_layouts = pCB->imageLayoutMap.find(ilm_entry.first);
+                if (primary_layouts == pCB->imageLayoutMap.end()) {
+                    primary_layouts = pCB->imageLayoutMap.emplace(ilm_entry.first, CmdBufImageLayoutMap(ilm_entry.second)).first;
                 }
+                auto &cb_layouts = primary_layouts->second;
+                // Subresources the primary has already used keep their initial layout
+                ilm_entry.second.ForEachRun([&](CmdBufImageLayoutMap::Key begin, CmdBufImageLayoutMap::Key end,
+                                                IMAGE_CMD_BUF_LAYOUT_NODE const &sub_node) {
+                    cb_layouts.Update(begin, end, [&](IMAGE_CMD_BUF_LAYOUT_NODE const *node) {
+                        return node ? IMAGE_CMD_BUF_LAYOUT_NODE(node->initialLayout, sub_node.layout) : sub_node;
+                    });
+                });
             }
             pSubCB->primaryCommandBuffer = pCB->commandBuffer;
             pCB->linkedCommandBuffers.insert(pSubCB);
@@ -10257,8 +10753,8 @@ static void PostCallRecordQueueBindSparse(layer_data *dev_data, VkQueue queue, u
             SubmitFence(pQueue, pFence, std::max(1u, bindInfoCount));
             if (!bindInfoCount) {
                 // No work to do, just dropping a fence in the queue by itself.
-                pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), std::vector<SEMAPHORE_WAIT>(),
-                                                 std::vector<VkSemaphore>(), std::vector<VkSemaphore>(), fence);
+                pQueue->submissions.emplace_back().fence = fence;
+                StampSubmissionClock(dev_data, pQueue);
             }
         } else {
             // Retire work up until this fence early, we will not see the wait that corresponds to this signal
@@ -10302,9 +10798,10 @@ static void PostCallRecordQueueBindSparse(layer_data *dev_data, VkQueue queue, u
             }
         }
 
-        std::vector<SEMAPHORE_WAIT> semaphore_waits;
-        std::vector<VkSemaphore> semaphore_signals;
-        std::vector<VkSemaphore> semaphore_externals;
+        CB_SUBMISSION &submission = pQueue->submissions.emplace_back();
+        auto &semaphore_waits = submission.waitSemaphores;
+        auto &semaphore_signals = submission.signalSemaphores;
+        auto &semaphore_externals = submission.externalSemaphores;
         for (uint32_t i = 0; i < bindInfo.waitSemaphoreCount; ++i) {
             VkSemaphore semaphore = bindInfo.pWaitSemaphores[i];
             auto pSemaphore = GetSemaphoreNode(dev_data, semaphore);
@@ -10331,13 +10828,13 @@ static void PostCallRecordQueueBindSparse(layer_data *dev_data, VkQueue queue, u
             if (pSemaphore) {
                 if (pSemaphore->scope == kSyncScopeInternal) {
                     pSemaphore->signaler.first = queue;
-                    pSemaphore->signaler.second = pQueue->seq + pQueue->submissions.size() + 1;
+                    pSemaphore->signaler.second = pQueue->seq + pQueue->submissions.size();
                     pSemaphore->signaled = true;
                     pSemaphore->in_use.fetch_add(1);
                     semaphore_signals.push_back(semaphore);
                 } else {
                     // Retire work up until this submit early, we will not see the wait that corresponds to this signal
-                    early_retire_seq = std::max(early_retire_seq, pQueue->seq + pQueue->submissions.size() + 1);
+                    early_retire_seq = std::max(early_retire_seq, pQueue->seq + pQueue->submissions.size());
                     if (!dev_data->external_sync_warning) {
                         dev_data->external_sync_warning = true;
                         log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT,
@@ -10351,8 +10848,8 @@ static void PostCallRecordQueueBindSparse(layer_data *dev_data, VkQueue queue, u
             }
         }
 
-        pQueue->submissions.emplace_back(std::vector<VkCommandBuffer>(), semaphore_waits, semaphore_signals, semaphore_externals,
-                                         bindIdx == bindInfoCount - 1 ? fence : VK_NULL_HANDLE);
+        submission.fence = bindIdx == bindInfoCount - 1 ? fence : VK_NULL_HANDLE;
+        StampSubmissionClock(dev_data, pQueue);
     }
 
     if (early_retire_seq) {
@@ -10891,16 +11388,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
         // Pre-record to avoid Destroy/Create race
         if (swapchain_data->images.size() > 0) {
             for (auto swapchain_image : swapchain_data->images) {
-                auto image_sub = dev_data->imageSubresourceMap.find(swapchain_image);
-                if (image_sub != dev_data->imageSubresourceMap.end()) {
-                    for (auto imgsubpair : image_sub->second) {
-                        auto image_item = dev_data->imageLayoutMap.find(imgsubpair);
-                        if (image_item != dev_data->imageLayoutMap.end()) {
-                            dev_data->imageLayoutMap.erase(image_item);
-                        }
-                    }
-                    dev_data->imageSubresourceMap.erase(image_sub);
-                }
+                dev_data->imageLayoutMap.erase(swapchain_image);
                 skip = ClearMemoryObjectBindings(dev_data, HandleToUint64(swapchain_image), kVulkanObjectTypeSwapchainKHR);
                 EraseQFOImageRelaseBarriers(dev_data, swapchain_image);
                 dev_data->imageMap.erase(swapchain_image);
@@ -10955,9 +11443,6 @@ static void PostCallRecordGetSwapchainImagesKHR(layer_data *device_data, SWAPCHA
         for (uint32_t i = 0; i < *pSwapchainImageCount; ++i) {
             if (swapchain_state->images[i] != VK_NULL_HANDLE) continue;  // Already retrieved this.
 
-            IMAGE_LAYOUT_NODE image_layout_node;
-            image_layout_node.layout = VK_IMAGE_LAYOUT_UNDEFINED;
-            image_layout_node.format = swapchain_state->createInfo.imageFormat;
             // Add imageMap entries for each swapchain image
             VkImageCreateInfo image_ci = {};
             image_ci.flags = 0;
@@ -10972,14 +11457,13 @@ static void PostCallRecordGetSwapchainImagesKHR(layer_data *device_data, SWAPCHA
             image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
             image_ci.usage = swapchain_state->createInfo.imageUsage;
             image_ci.sharingMode = swapchain_state->createInfo.imageSharingMode;
-            device_data->imageMap[pSwapchainImages[i]] = unique_ptr<IMAGE_STATE>(new IMAGE_STATE(pSwapchainImages[i], &image_ci));
+            device_data->imageMap.emplace(pSwapchainImages[i],
+                                          unique_ptr<IMAGE_STATE>(new IMAGE_STATE(pSwapchainImages[i], &image_ci)));
             auto &image_state = device_data->imageMap[pSwapchainImages[i]];
             image_state->valid = false;
             image_state->binding.mem = MEMTRACKER_SWAP_CHAIN_IMAGE_KEY;
             swapchain_state->images[i] = pSwapchainImages[i];
-            ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
-            device_data->imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
-            device_data->imageLayoutMap[subpair] = image_layout_node;
+            device_data->imageLayoutMap.emplace(pSwapchainImages[i], IMAGE_LAYOUT_NODE(image_ci, VK_IMAGE_LAYOUT_UNDEFINED));
         }
     }
 
@@ -35,7 +35,6 @@
 #include <unordered_set>
 #include <vector>
 #include <list>
-#include <deque>
 
 /*
  * MTMTODO : Update this comment
@@ -109,8 +108,9 @@ class QUEUE_STATE {
     std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
     std::unordered_map<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
 
+    uint32_t timeline_index;  // Position in the device's queue timeline and in each submission's clock
     uint64_t seq;
-    std::deque<CB_SUBMISSION> submissions;
+    RecyclingRing<CB_SUBMISSION> submissions;
 };
 
 class QUERY_POOL_NODE : public BASE_NODE {
@@ -161,6 +161,8 @@ enum DRAW_STATE_ERROR {
     DRAWSTATE_SWAPCHAIN_IMAGES_NOT_FOUND,
     DRAWSTATE_EXTENSION_NOT_ENABLED,
     DRAWSTATE_INVALID_IMAGE_SUBRANGE,
+    DRAWSTATE_DEFERRED_SUBMIT_VALIDATION,
+    DRAWSTATE_DESCRIPTOR_POOL_STATS,
 };
 
 // Shader Checker ERROR codes
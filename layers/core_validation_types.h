@@ -30,6 +30,11 @@
 #include "vk_layer_logging.h"
 #include "vk_object_types.h"
 #include "vk_extension_helper.h"
+#include "concurrent_map.h"
+#include "image_layout_map.h"
+#include "recycling_ring.h"
+#include "slab_allocator.h"
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <map>
@@ -38,8 +43,15 @@
 #include <unordered_set>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <list>
 
+// Handle -> state maps. Lookups are wait-free so they may run under a shared global_lock, or with only a
+// lock_util::EpochGuard on paths that touch no mutable state; inserts and erases still require the exclusive lock.
+// Maps holding raw pointers free the pointee through erase(handle, release) so readers never see it deleted.
+template <typename Handle, typename State>
+using HandleMap = lock_util::ConcurrentUnorderedMap<Handle, State>;
+
 // Fwd declarations -- including descriptor_set.h creates an ugly include loop
 namespace cvdescriptorset {
 class DescriptorSetLayoutDef;
@@ -140,6 +152,10 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
     std::unordered_set<cvdescriptorset::DescriptorSet *> sets;  // Collection of all sets in this pool
     std::vector<uint32_t> maxDescriptorTypeCount;               // Max # of descriptors of each type in this pool
     std::vector<uint32_t> availableDescriptorTypeCount;         // Available # of descriptors of each type in this pool
+    // Storage for this pool's sets; freed and reset sets are recycled rather than returned to the heap
+    SlabAllocator<cvdescriptorset::DescriptorSet> set_allocator;
+    // Freed and reset sets, which lock-free setMap readers may still hold; set_allocator gets them back in ReclaimRetiredSets()
+    lock_util::RetireList<cvdescriptorset::DescriptorSet *> retired_sets;
 
     DESCRIPTOR_POOL_STATE(const VkDescriptorPool pool, const VkDescriptorPoolCreateInfo *pCreateInfo)
         : pool(pool),
@@ -147,7 +163,8 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
           availableSets(pCreateInfo->maxSets),
           createInfo(pCreateInfo),
           maxDescriptorTypeCount(VK_DESCRIPTOR_TYPE_RANGE_SIZE, 0),
-          availableDescriptorTypeCount(VK_DESCRIPTOR_TYPE_RANGE_SIZE, 0) {
+          availableDescriptorTypeCount(VK_DESCRIPTOR_TYPE_RANGE_SIZE, 0),
+          set_allocator(std::min<uint32_t>(pCreateInfo->maxSets, 64)) {
         // Collect maximums per descriptor type.
         for (uint32_t i = 0; i < createInfo.poolSizeCount; ++i) {
             uint32_t typeIndex = static_cast<uint32_t>(createInfo.pPoolSizes[i].type);
@@ -156,6 +173,9 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
             availableDescriptorTypeCount[typeIndex] = maxDescriptorTypeCount[typeIndex];
         }
     }
+    // Defined in core_validation.cpp, where DescriptorSet is complete
+    ~DESCRIPTOR_POOL_STATE();
+    void ReclaimRetiredSets();
 };
 
 // Generic memory binding struct to track objects bound to objects
@@ -332,8 +352,6 @@ struct MEMORY_RANGE {
     VkDeviceSize start;
     VkDeviceSize size;
     VkDeviceSize end;  // Store this pre-computed for simplicity
-    // Set of ptrs to every range aliased with this one
-    std::unordered_set<MEMORY_RANGE *> aliases;
 };
 
 // Data struct for tracking memory object
@@ -346,6 +364,9 @@ struct DEVICE_MEM_INFO : public BASE_NODE {
     VkImage dedicated_image;
     std::unordered_set<VK_OBJECT> obj_bindings;               // objects bound to this memory
     std::unordered_map<uint64_t, MEMORY_RANGE> bound_ranges;  // Map of object to its binding range
+    // The entries of bound_ranges ordered by start offset, so overlap queries only visit nearby ranges
+    std::multimap<VkDeviceSize, MEMORY_RANGE *> bound_ranges_by_start;
+    VkDeviceSize max_bound_range_size;  // Largest size ever bound; bounds how far before a query a range can start
     // Convenience vectors image/buff handles to speed up iterating over images or buffers independently
     std::unordered_set<uint64_t> bound_images;
     std::unordered_set<uint64_t> bound_buffers;
@@ -364,11 +385,27 @@ struct DEVICE_MEM_INFO : public BASE_NODE {
           is_dedicated(false),
           dedicated_buffer(VK_NULL_HANDLE),
           dedicated_image(VK_NULL_HANDLE),
+          max_bound_range_size(0),
           mem_range{},
           shadow_copy_base(0),
           shadow_copy(0),
           shadow_pad_size(0),
           p_driver_data(0){};
+
+    // Call fn on every bound range which could intersect [start, end] once both are aligned down to granularity (a power
+    // of two). This is a superset of the intersecting ranges; callers still test each one with rangesIntersect.
+    template <typename Fn>
+    void ForEachBoundRangeNear(VkDeviceSize start, VkDeviceSize end, VkDeviceSize granularity, Fn fn) const {
+        if (bound_ranges_by_start.empty()) return;
+        VkDeviceSize mask = ~(std::max<VkDeviceSize>(granularity, 1) - 1);
+        // A candidate's aligned end must reach start's aligned value, and its aligned start must not pass end's.
+        VkDeviceSize first = start & mask;
+        first = first >= max_bound_range_size ? first - max_bound_range_size : 0;
+        VkDeviceSize last = (end & mask) + ~mask;
+        for (auto it = bound_ranges_by_start.lower_bound(first); it != bound_ranges_by_start.end() && it->first <= last; ++it) {
+            fn(it->second);
+        }
+    }
 };
 
 class SWAPCHAIN_NODE {
@@ -394,6 +431,12 @@ class IMAGE_CMD_BUF_LAYOUT_NODE {
     VkImageLayout layout;
 };
 
+inline bool operator==(const IMAGE_CMD_BUF_LAYOUT_NODE &a, const IMAGE_CMD_BUF_LAYOUT_NODE &b) {
+    return a.initialLayout == b.initialLayout && a.layout == b.layout;
+}
+
+typedef ImageSubresourceLayoutMap<IMAGE_CMD_BUF_LAYOUT_NODE> CmdBufImageLayoutMap;
+
 // Store the DAG.
 struct DAGNode {
     uint32_t pass;
@@ -506,6 +549,19 @@ enum CBStatusFlagBits {
     // clang-format on
 };
 
+// Draw-time state categories, marked dirty on a bind point as commands change them. Descriptor sets (with their dynamic
+// offsets) are tracked per set index instead, see DRAW_VALIDATION_CACHE.
+typedef VkFlags DrawStateDirtyFlags;
+enum DrawStateDirtyFlagBits {
+    // clang-format off
+    DRAW_DIRTY_PIPELINE             = 0x00000001,   // Pipeline bound; everything a draw checks depends on it
+    DRAW_DIRTY_DYNAMIC_STATE        = 0x00000002,   // vkCmdSet* state
+    DRAW_DIRTY_VERTEX_BUFFERS       = 0x00000004,   // Vertex buffer bindings
+    DRAW_DIRTY_INDEX_BUFFER         = 0x00000008,   // Index buffer binding
+    DRAW_DIRTY_SUBPASS              = 0x00000010,   // Active render pass or subpass
+    // clang-format on
+};
+
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
@@ -535,35 +591,6 @@ struct DRAW_DATA {
     std::vector<VkBuffer> buffers;
 };
 
-struct ImageSubresourcePair {
-    VkImage image;
-    bool hasSubresource;
-    VkImageSubresource subresource;
-};
-
-inline bool operator==(const ImageSubresourcePair &img1, const ImageSubresourcePair &img2) {
-    if (img1.image != img2.image || img1.hasSubresource != img2.hasSubresource) return false;
-    return !img1.hasSubresource ||
-           (img1.subresource.aspectMask == img2.subresource.aspectMask && img1.subresource.mipLevel == img2.subresource.mipLevel &&
-            img1.subresource.arrayLayer == img2.subresource.arrayLayer);
-}
-
-namespace std {
-template <>
-struct hash<ImageSubresourcePair> {
-    size_t operator()(ImageSubresourcePair img) const throw() {
-        size_t hashVal = hash<uint64_t>()(reinterpret_cast<uint64_t &>(img.image));
-        hashVal ^= hash<bool>()(img.hasSubresource);
-        if (img.hasSubresource) {
-            hashVal ^= hash<uint32_t>()(reinterpret_cast<uint32_t &>(img.subresource.aspectMask));
-            hashVal ^= hash<uint32_t>()(img.subresource.mipLevel);
-            hashVal ^= hash<uint32_t>()(img.subresource.arrayLayer);
-        }
-        return hashVal;
-    }
-};
-}  // namespace std
-
 // Canonical dictionary for PushConstantRanges
 using PushConstantRangesDict = hash_util::Dictionary<PushConstantRanges>;
 using PushConstantRangesId = PushConstantRangesDict::Id;
@@ -707,6 +734,87 @@ class PIPELINE_STATE : public BASE_NODE {
     }
 };
 
+// Draw-time checks on one bind point that last ran without logging anything, so that draws with unchanged state can skip them.
+// A check stays clean until state it reads is marked dirty. Descriptor set checks also read state that changes outside of the
+// command buffer's own binding commands (set contents, the command buffer's image layouts), which is versioned instead.
+struct DRAW_VALIDATION_CACHE {
+    enum Check {
+        kStateFlags,         // Dynamic state flags required by the pipeline
+        kStateFlagsIndexed,  // ... plus the index buffer
+        kPipelineDrawtime,   // Vertex buffers, viewports and scissors, render pass and subpass
+        kCheckCount
+    };
+    static const uint32_t kMaxCachedSets = 64;
+
+    DRAW_VALIDATION_CACHE() : clean_checks_(0), clean_sets_(0) {}
+
+    void Reset() {
+        clean_checks_ = 0;
+        clean_sets_ = 0;
+    }
+
+    void MarkDirty(DrawStateDirtyFlags dirty) {
+        for (uint32_t check = 0; check < kCheckCount; ++check) {
+            if (dirty & CheckInputs(static_cast<Check>(check))) clean_checks_ &= ~(1u << check);
+        }
+        if (dirty & DRAW_DIRTY_PIPELINE) clean_sets_ = 0;
+    }
+    void MarkSetDirty(uint32_t set) {
+        if (set < kMaxCachedSets) clean_sets_ &= ~(uint64_t(1) << set);
+    }
+    // Marks first and every set index above it
+    void MarkSetsDirtyFrom(uint32_t first) {
+        if (first < kMaxCachedSets) clean_sets_ &= (uint64_t(1) << first) - 1;
+    }
+
+    bool IsClean(Check check) const { return (clean_checks_ & (1u << check)) != 0; }
+    void SetClean(Check check, bool clean) {
+        if (clean) {
+            clean_checks_ |= 1u << check;
+        } else {
+            clean_checks_ &= ~(1u << check);
+        }
+    }
+
+    bool IsSetClean(uint32_t set, uint64_t update_count, uint64_t layout_change_count) const {
+        if ((set >= kMaxCachedSets) || !(clean_sets_ & (uint64_t(1) << set))) return false;
+        const SetVersion &version = set_versions_[set];
+        return (version.update_count == update_count) && (version.layout_change_count == layout_change_count);
+    }
+    void SetSetClean(uint32_t set, bool clean, uint64_t update_count, uint64_t layout_change_count) {
+        if (set >= kMaxCachedSets) return;
+        if (!clean) {
+            MarkSetDirty(set);
+            return;
+        }
+        if (set_versions_.size() <= set) set_versions_.resize(set + 1);
+        set_versions_[set].update_count = update_count;
+        set_versions_[set].layout_change_count = layout_change_count;
+        clean_sets_ |= uint64_t(1) << set;
+    }
+
+   private:
+    static DrawStateDirtyFlags CheckInputs(Check check) {
+        switch (check) {
+            case kStateFlags:
+                return DRAW_DIRTY_PIPELINE | DRAW_DIRTY_DYNAMIC_STATE;
+            case kStateFlagsIndexed:
+                return DRAW_DIRTY_PIPELINE | DRAW_DIRTY_DYNAMIC_STATE | DRAW_DIRTY_INDEX_BUFFER;
+            default:
+                return DRAW_DIRTY_PIPELINE | DRAW_DIRTY_DYNAMIC_STATE | DRAW_DIRTY_VERTEX_BUFFERS | DRAW_DIRTY_SUBPASS;
+        }
+    }
+
+    struct SetVersion {
+        uint64_t update_count;         // DescriptorSet::GetUpdateCount()
+        uint64_t layout_change_count;  // GLOBAL_CB_NODE::image_layout_change_count
+    };
+
+    uint32_t clean_checks_;  // Bit per Check
+    uint64_t clean_sets_;    // Bit per set index
+    std::vector<SetVersion> set_versions_;
+};
+
 // Track last states that are bound per pipeline bind point (Gfx & Compute)
 struct LAST_BOUND_STATE {
     PIPELINE_STATE *pipeline_state;
@@ -718,6 +826,7 @@ struct LAST_BOUND_STATE {
     // one dynamic offset per dynamic descriptor bound to this CB
     std::vector<std::vector<uint32_t>> dynamicOffsets;
     std::vector<PipelineLayoutCompatId> compat_id_for_set;
+    DRAW_VALIDATION_CACHE draw_validation;
 
     void reset() {
         pipeline_state = nullptr;
@@ -725,6 +834,7 @@ struct LAST_BOUND_STATE {
         boundDescriptorSets.clear();
         push_descriptor_set = nullptr;
         dynamicOffsets.clear();
+        draw_validation.Reset();
     }
 };
 
@@ -828,13 +938,14 @@ struct QFOTransferBarrier<VkBufferMemoryBarrier> : public QFOTransferBarrierBase
 template <typename Barrier>
 using QFOTransferBarrierHash = hash_util::HasHashMember<QFOTransferBarrier<Barrier>>;
 
-// Command buffers store the set of barriers recorded
 template <typename Barrier>
 using QFOTransferBarrierSet = std::unordered_set<QFOTransferBarrier<Barrier>, QFOTransferBarrierHash<Barrier>>;
+// Command buffers store the set of barriers recorded, in their own recycled storage
 template <typename Barrier>
 struct QFOTransferBarrierSets {
-    QFOTransferBarrierSet<Barrier> release;
-    QFOTransferBarrierSet<Barrier> acquire;
+    explicit QFOTransferBarrierSets(NodeRecycler *recycler) : release(recycler), acquire(recycler) {}
+    RecyclingUnorderedSet<QFOTransferBarrier<Barrier>, QFOTransferBarrierHash<Barrier>> release;
+    RecyclingUnorderedSet<QFOTransferBarrier<Barrier>, QFOTransferBarrierHash<Barrier>> acquire;
     void Reset() {
         acquire.clear();
         release.clear();
@@ -858,6 +969,12 @@ struct QFOTransferCBScoreboards {
 
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
 struct GLOBAL_CB_NODE : public BASE_NODE {
+    GLOBAL_CB_NODE();
+
+    // Backs the unordered containers below, so that resetting and re-recording reuses their nodes. Declared first so that
+    //  it outlives them.
+    NodeRecycler node_recycler;
+
     VkCommandBuffer commandBuffer;
     VkCommandBufferAllocateInfo createInfo = {};
     VkCommandBufferBeginInfo beginInfo;
@@ -884,44 +1001,50 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     VkSubpassContents activeSubpassContents;
     uint32_t activeSubpass;
     VkFramebuffer activeFramebuffer;
-    std::unordered_set<VkFramebuffer> framebuffers;
+    RecyclingUnorderedSet<VkFramebuffer> framebuffers;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    std::unordered_set<VK_OBJECT> object_bindings;
+    RecyclingUnorderedSet<VK_OBJECT> object_bindings;
     std::vector<VK_OBJECT> broken_bindings;
+    // State objects of object_bindings and drawData buffers, flattened at vkEndCommandBuffer so submit/retire can adjust in_use
+    //  counts without per-object lookups. Only meaningful while state == CB_RECORDED: every one of them has this CB in its
+    //  cb_bindings (vertex buffers are bound at vkCmdBindVertexBuffers), so destroying it moves the CB out of CB_RECORDED.
+    std::vector<BASE_NODE *> in_use_nodes;
 
     QFOTransferBarrierSets<VkBufferMemoryBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<VkImageMemoryBarrier> qfo_transfer_image_barriers;
 
-    std::unordered_set<VkEvent> waitedEvents;
+    RecyclingUnorderedSet<VkEvent> waitedEvents;
     std::vector<VkEvent> writeEventsBeforeWait;
     std::vector<VkEvent> events;
-    std::unordered_map<QueryObject, std::unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
-    std::unordered_map<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
-    std::unordered_set<QueryObject> activeQueries;
-    std::unordered_set<QueryObject> startedQueries;
-    std::unordered_map<ImageSubresourcePair, IMAGE_CMD_BUF_LAYOUT_NODE> imageLayoutMap;
-    std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
+    RecyclingUnorderedMap<QueryObject, RecyclingUnorderedSet<VkEvent>> waitedEventsBeforeQueryReset;
+    RecyclingUnorderedMap<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
+    RecyclingUnorderedSet<QueryObject> activeQueries;
+    RecyclingUnorderedSet<QueryObject> startedQueries;
+    RecyclingUnorderedMap<VkImage, CmdBufImageLayoutMap> imageLayoutMap;
+    RecyclingUnorderedMap<VkEvent, VkPipelineStageFlags> eventToStageMap;
     std::vector<DRAW_DATA> drawData;
     DRAW_DATA currentDrawData;
     bool vertex_buffer_used;  // Track for perf warning to make sure any bound vtx buffer used
     VkCommandBuffer primaryCommandBuffer;
     // Track images and buffers that are updated by this CB at the point of a draw
-    std::unordered_set<VkImageView> updateImages;
-    std::unordered_set<VkBuffer> updateBuffers;
+    RecyclingUnorderedSet<VkImageView> updateImages;
+    RecyclingUnorderedSet<VkBuffer> updateBuffers;
     // If primary, the secondary command buffers we will call.
     // If secondary, the primary command buffers we will be called by.
-    std::unordered_set<GLOBAL_CB_NODE *> linkedCommandBuffers;
+    RecyclingUnorderedSet<GLOBAL_CB_NODE *> linkedCommandBuffers;
     // Validation functions run at primary CB queue submit time
     std::vector<std::function<bool()>> queue_submit_functions;
     // Validation functions run when secondary CB is executed in primary
     std::vector<std::function<bool(GLOBAL_CB_NODE *, VkFramebuffer)>> cmd_execute_commands_functions;
-    std::unordered_set<VkDeviceMemory> memObjs;
+    RecyclingUnorderedSet<VkDeviceMemory> memObjs;
     std::vector<std::function<bool(VkQueue)>> eventUpdates;
     std::vector<std::function<bool(VkQueue)>> queryUpdates;
-    std::unordered_set<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
+    RecyclingUnorderedSet<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
     // Contents valid only after an index buffer is bound (CBSTATUS_INDEX_BUFFER_BOUND set)
     INDEX_BUFFER_BINDING index_buffer_binding;
+    // Serializes recording-time updates to this CB when core_validation runs with fine_grained_locking
+    std::mutex recording_lock;
 };
 
 static QFOTransferBarrierSets<VkImageMemoryBarrier> &GetQFOBarrierSets(
@@ -939,28 +1062,46 @@ struct SEMAPHORE_WAIT {
     uint64_t seq;
 };
 
+// One batch of a queue submission. Records are recycled through QUEUE_STATE::submissions, so the common case of a few command
+// buffers and semaphores is stored inline and larger batches keep their heap storage for the next submission.
 struct CB_SUBMISSION {
-    CB_SUBMISSION(std::vector<VkCommandBuffer> const &cbs, std::vector<SEMAPHORE_WAIT> const &waitSemaphores,
-                  std::vector<VkSemaphore> const &signalSemaphores, std::vector<VkSemaphore> const &externalSemaphores,
-                  VkFence fence)
-        : cbs(cbs),
-          waitSemaphores(waitSemaphores),
-          signalSemaphores(signalSemaphores),
-          externalSemaphores(externalSemaphores),
-          fence(fence) {}
-
-    std::vector<VkCommandBuffer> cbs;
-    std::vector<SEMAPHORE_WAIT> waitSemaphores;
-    std::vector<VkSemaphore> signalSemaphores;
-    std::vector<VkSemaphore> externalSemaphores;
+    CB_SUBMISSION() : fence(VK_NULL_HANDLE) {}
+    CB_SUBMISSION(CB_SUBMISSION &&) = default;
+    CB_SUBMISSION &operator=(CB_SUBMISSION &&) = default;
+
+    void clear() {
+        cbs.clear();
+        waitSemaphores.clear();
+        signalSemaphores.clear();
+        externalSemaphores.clear();
+        fence = VK_NULL_HANDLE;
+        clock.clear();
+    }
+
+    SmallVector<VkCommandBuffer, 4> cbs;
+    SmallVector<SEMAPHORE_WAIT, 2> waitSemaphores;
+    SmallVector<VkSemaphore, 2> signalSemaphores;
+    SmallVector<VkSemaphore, 1> externalSemaphores;
     VkFence fence;
+    // Vector clock over the device's queues, indexed by QUEUE_STATE::timeline_index. Entry i is the sequence number on queue i
+    // through which work must complete before this submission can; its own queue's entry is its own sequence number. Queues
+    // created after the submission have no entry.
+    SmallVector<uint64_t, 4> clock;
 };
 
+// Device-level layout state of one image
 struct IMAGE_LAYOUT_NODE {
-    VkImageLayout layout;
+    VkImageLayout layout;  // Whole-image layout from creation, or VK_IMAGE_LAYOUT_MAX_ENUM; subresources override it
     VkFormat format;
+    ImageSubresourceLayoutMap<VkImageLayout> subresources;
+
+    IMAGE_LAYOUT_NODE() : layout(VK_IMAGE_LAYOUT_MAX_ENUM), format(VK_FORMAT_UNDEFINED) {}
+    IMAGE_LAYOUT_NODE(const VkImageCreateInfo &create_info, VkImageLayout image_layout)
+        : layout(image_layout), format(create_info.format), subresources(create_info) {}
 };
 
+typedef std::unordered_map<VkImage, IMAGE_LAYOUT_NODE> ImageLayoutMap;
+
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // The end goal is to have all checks guarded by a bool. The bools are all "false" by default meaning that all checks
 // are enabled. At CreateInstance time, the user can use the VK_EXT_validation_flags extension to pass in enum values
@@ -1004,12 +1145,24 @@ struct MT_FB_ATTACHMENT_INFO {
     VkImage image;
 };
 
+// A problem found by render pass dependency validation. Only the parameters are kept, so the message can be reported again at
+// each vkCmdBeginRenderPass without redoing the analysis.
+struct RenderPassDependencyFinding {
+    enum Kind { kAttachmentAliasing, kColorDepthSameAttachment, kMissingDependency, kAttachmentNotPreserved };
+    Kind kind;
+    uint32_t first;   // Attachment, or subpass for kMissingDependency
+    uint32_t second;  // Other attachment for kAttachmentAliasing, otherwise a subpass
+};
+
 class FRAMEBUFFER_STATE : public BASE_NODE {
    public:
     VkFramebuffer framebuffer;
     safe_VkFramebufferCreateInfo createInfo;
     std::shared_ptr<RENDER_PASS_STATE> rp_state;
     std::vector<MT_FB_ATTACHMENT_INFO> attachments;
+    // Dependency validation findings for each render pass this framebuffer has been begun with. Render passes are held
+    // weakly, so a destroyed render pass (or a new one reusing its handle) never matches a stale entry.
+    std::vector<std::pair<std::weak_ptr<RENDER_PASS_STATE>, std::vector<RenderPassDependencyFinding>>> dependency_findings;
     FRAMEBUFFER_STATE(VkFramebuffer fb, const VkFramebufferCreateInfo *pCreateInfo, std::shared_ptr<RENDER_PASS_STATE> &&rpstate)
         : framebuffer(fb), createInfo(pCreateInfo), rp_state(rpstate){};
 };
@@ -1042,8 +1195,10 @@ const DeviceExtensions *GetEnabledExtensions(const layer_data *device_data);
 const VkPhysicalDeviceDescriptorIndexingFeaturesEXT *GetEnabledDescriptorIndexingFeatures(const layer_data *device_data);
 
 void invalidateCommandBuffers(const layer_data *, std::unordered_set<GLOBAL_CB_NODE *> const &, VK_OBJECT);
+void invalidateCommandBuffers(const layer_data *, RecyclingUnorderedSet<GLOBAL_CB_NODE *> const &, VK_OBJECT);
 bool ValidateMemoryIsBoundToBuffer(const layer_data *, const BUFFER_STATE *, const char *, const std::string &);
 bool ValidateMemoryIsBoundToImage(const layer_data *, const IMAGE_STATE *, const char *, const std::string &);
+void InsertCommandBufferBinding(std::unordered_set<GLOBAL_CB_NODE *> *, GLOBAL_CB_NODE *);
 void AddCommandBufferBindingSampler(GLOBAL_CB_NODE *, SAMPLER_STATE *);
 void AddCommandBufferBindingImage(const layer_data *, GLOBAL_CB_NODE *, IMAGE_STATE *);
 void AddCommandBufferBindingImageView(const layer_data *, GLOBAL_CB_NODE *, IMAGE_VIEW_STATE *);
@@ -1056,13 +1211,11 @@ void RemoveImageMemoryRange(uint64_t handle, DEVICE_MEM_INFO *mem_info);
 void RemoveBufferMemoryRange(uint64_t handle, DEVICE_MEM_INFO *mem_info);
 bool ClearMemoryObjectBindings(layer_data *dev_data, uint64_t handle, VulkanObjectType type);
 bool ValidateCmdQueueFlags(layer_data *dev_data, const GLOBAL_CB_NODE *cb_node, const char *caller_name, VkQueueFlags flags,
-                           const std::string &error_code);
+                           const char *error_code);
 bool ValidateCmd(layer_data *my_data, const GLOBAL_CB_NODE *pCB, const CMD_TYPE cmd, const char *caller_name);
-bool insideRenderPass(const layer_data *my_data, const GLOBAL_CB_NODE *pCB, const char *apiName, const std::string &msgCode);
+bool insideRenderPass(const layer_data *my_data, const GLOBAL_CB_NODE *pCB, const char *apiName, const char *msgCode);
 void SetImageMemoryValid(layer_data *dev_data, IMAGE_STATE *image_state, bool valid);
-bool outsideRenderPass(const layer_data *my_data, GLOBAL_CB_NODE *pCB, const char *apiName, const std::string &msgCode);
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const IMAGE_CMD_BUF_LAYOUT_NODE &node);
-void SetLayout(GLOBAL_CB_NODE *pCB, ImageSubresourcePair imgpair, const VkImageLayout &layout);
+bool outsideRenderPass(const layer_data *my_data, GLOBAL_CB_NODE *pCB, const char *apiName, const char *msgCode);
 bool ValidateImageMemoryIsValid(layer_data *dev_data, IMAGE_STATE *image_state, const char *functionName);
 bool ValidateImageSampleCount(layer_data *dev_data, IMAGE_STATE *image_state, VkSampleCountFlagBits sample_count,
                               const char *location, const std::string &msgCode);
@@ -1079,13 +1232,12 @@ VkResult GetImageFormatProperties(core_validation::layer_data *device_data, cons
 const debug_report_data *GetReportData(const layer_data *);
 const VkPhysicalDeviceProperties *GetPhysicalDeviceProperties(layer_data *);
 const CHECK_DISABLED *GetDisables(layer_data *);
-std::unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *);
-std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *GetImageSubresourceMap(layer_data *);
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> *GetImageLayoutMap(layer_data *);
-std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> const *GetImageLayoutMap(layer_data const *);
-std::unordered_map<VkBuffer, std::unique_ptr<BUFFER_STATE>> *GetBufferMap(layer_data *device_data);
-std::unordered_map<VkBufferView, std::unique_ptr<BUFFER_VIEW_STATE>> *GetBufferViewMap(layer_data *device_data);
-std::unordered_map<VkImageView, std::unique_ptr<IMAGE_VIEW_STATE>> *GetImageViewMap(layer_data *device_data);
+HandleMap<VkImage, std::unique_ptr<IMAGE_STATE>> *GetImageMap(core_validation::layer_data *);
+ImageLayoutMap *GetImageLayoutMap(layer_data *);
+ImageLayoutMap const *GetImageLayoutMap(layer_data const *);
+HandleMap<VkBuffer, std::unique_ptr<BUFFER_STATE>> *GetBufferMap(layer_data *device_data);
+HandleMap<VkBufferView, std::unique_ptr<BUFFER_VIEW_STATE>> *GetBufferViewMap(layer_data *device_data);
+HandleMap<VkImageView, std::unique_ptr<IMAGE_VIEW_STATE>> *GetImageViewMap(layer_data *device_data);
 const DeviceExtensions *GetDeviceExtensions(const layer_data *);
 uint32_t GetApiVersion(const layer_data *);
 
@@ -548,10 +548,31 @@ bool cvdescriptorset::DescriptorSetLayout::ValidateCreateInfo(
 cvdescriptorset::AllocateDescriptorSetsData::AllocateDescriptorSetsData(uint32_t count)
     : required_descriptors_by_type{}, layout_nodes(count, nullptr) {}
 
+// The descriptor class used to store descriptors of the given type
+static cvdescriptorset::DescriptorClass DescriptorClassFromType(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            return cvdescriptorset::PlainSampler;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            return cvdescriptorset::ImageSampler;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return cvdescriptorset::TexelBuffer;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return cvdescriptorset::GeneralBuffer;
+        default:
+            return cvdescriptorset::Image;
+    }
+}
+
 cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const VkDescriptorPool pool,
                                               const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                               layer_data *dev_data)
     : some_update_(false),
+      update_count_(0),
       set_(set),
       pool_state_(nullptr),
       p_layout_(layout),
@@ -559,6 +580,16 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
       limits_(GetPhysDevProperties(dev_data)->properties.limits),
       variable_count_(variable_count) {
     pool_state_ = GetDescriptorPoolState(dev_data, pool);
+    // Size each class's array up front so that a set costs one allocation per class rather than one per descriptor
+    uint32_t class_counts[GeneralBuffer + 1] = {};
+    for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
+        class_counts[DescriptorClassFromType(p_layout_->GetTypeFromIndex(i))] += p_layout_->GetDescriptorCountFromIndex(i);
+    }
+    sampler_descriptors_.reserve(class_counts[PlainSampler]);
+    image_sampler_descriptors_.reserve(class_counts[ImageSampler]);
+    image_descriptors_.reserve(class_counts[Image]);
+    texel_descriptors_.reserve(class_counts[TexelBuffer]);
+    buffer_descriptors_.reserve(class_counts[GeneralBuffer]);
     // Foreach binding, create default descriptors of given type
     descriptors_.reserve(p_layout_->GetTotalDescriptorCount());
     for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
@@ -568,10 +599,11 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
                 auto immut_sampler = p_layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut_sampler) {
-                        descriptors_.emplace_back(new SamplerDescriptor(immut_sampler + di));
+                        sampler_descriptors_.emplace_back(immut_sampler + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else
-                        descriptors_.emplace_back(new SamplerDescriptor(nullptr));
+                        sampler_descriptors_.emplace_back(nullptr);
+                    descriptors_.push_back(&sampler_descriptors_.back());
                 }
                 break;
             }
@@ -579,10 +611,11 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
                 auto immut = p_layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut) {
-                        descriptors_.emplace_back(new ImageSamplerDescriptor(immut + di));
+                        image_sampler_descriptors_.emplace_back(immut + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else
-                        descriptors_.emplace_back(new ImageSamplerDescriptor(nullptr));
+                        image_sampler_descriptors_.emplace_back(nullptr);
+                    descriptors_.push_back(&image_sampler_descriptors_.back());
                 }
                 break;
             }
@@ -590,20 +623,26 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ImageDescriptor(type));
+                for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
+                    image_descriptors_.emplace_back(type);
+                    descriptors_.push_back(&image_descriptors_.back());
+                }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new TexelDescriptor(type));
+                for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
+                    texel_descriptors_.emplace_back(type);
+                    descriptors_.push_back(&texel_descriptors_.back());
+                }
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new BufferDescriptor(type));
+                for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
+                    buffer_descriptors_.emplace_back(type);
+                    descriptors_.push_back(&buffer_descriptors_.back());
+                }
                 break;
             default:
                 assert(0);  // Bad descriptor type specified
@@ -672,7 +711,7 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                 auto descriptor_class = descriptors_[i]->GetClass();
                 if (descriptor_class == GeneralBuffer) {
                     // Verify that buffers are valid
-                    auto buffer = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetBuffer();
+                    auto buffer = static_cast<BufferDescriptor *>(descriptors_[i])->GetBuffer();
                     auto buffer_node = GetBufferState(device_data_, buffer);
                     if (!buffer_node) {
                         std::stringstream error_str;
@@ -694,8 +733,8 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                     if (descriptors_[i]->IsDynamic()) {
                         // Validate that dynamic offsets are within the buffer
                         auto buffer_size = buffer_node->createInfo.size;
-                        auto range = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetRange();
-                        auto desc_offset = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetOffset();
+                        auto range = static_cast<BufferDescriptor *>(descriptors_[i])->GetRange();
+                        auto desc_offset = static_cast<BufferDescriptor *>(descriptors_[i])->GetOffset();
                         auto dyn_offset = dynamic_offsets[GetDynamicOffsetIndexFromBinding(binding) + array_idx];
                         if (VK_WHOLE_SIZE == range) {
                             if ((dyn_offset + desc_offset) > buffer_size) {
@@ -723,11 +762,11 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                     VkImageView image_view;
                     VkImageLayout image_layout;
                     if (descriptor_class == ImageSampler) {
-                        image_view = static_cast<ImageSamplerDescriptor *>(descriptors_[i].get())->GetImageView();
-                        image_layout = static_cast<ImageSamplerDescriptor *>(descriptors_[i].get())->GetImageLayout();
+                        image_view = static_cast<ImageSamplerDescriptor *>(descriptors_[i])->GetImageView();
+                        image_layout = static_cast<ImageSamplerDescriptor *>(descriptors_[i])->GetImageLayout();
                     } else {
-                        image_view = static_cast<ImageDescriptor *>(descriptors_[i].get())->GetImageView();
-                        image_layout = static_cast<ImageDescriptor *>(descriptors_[i].get())->GetImageLayout();
+                        image_view = static_cast<ImageDescriptor *>(descriptors_[i])->GetImageView();
+                        image_layout = static_cast<ImageDescriptor *>(descriptors_[i])->GetImageLayout();
                     }
                     auto reqs = binding_pair.second;
 
@@ -795,9 +834,9 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                     // Verify Sampler still valid
                     VkSampler sampler;
                     if (descriptor_class == ImageSampler) {
-                        sampler = static_cast<ImageSamplerDescriptor *>(descriptors_[i].get())->GetSampler();
+                        sampler = static_cast<ImageSamplerDescriptor *>(descriptors_[i])->GetSampler();
                     } else {
-                        sampler = static_cast<SamplerDescriptor *>(descriptors_[i].get())->GetSampler();
+                        sampler = static_cast<SamplerDescriptor *>(descriptors_[i])->GetSampler();
                     }
                     if (!ValidateSampler(sampler, device_data_)) {
                         std::stringstream error_str;
@@ -815,8 +854,8 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
 
 // For given bindings, place any update buffers or images into the passed-in unordered_sets
 uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32_t, descriptor_req> &bindings,
-                                                           std::unordered_set<VkBuffer> *buffer_set,
-                                                           std::unordered_set<VkImageView> *image_set) const {
+                                                           RecyclingUnorderedSet<VkBuffer> *buffer_set,
+                                                           RecyclingUnorderedSet<VkImageView> *image_set) const {
     auto num_updates = 0;
     for (auto binding_pair : bindings) {
         auto binding = binding_pair.first;
@@ -829,14 +868,14 @@ uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32
             if (Image == descriptors_[start_idx]->descriptor_class) {
                 for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
                     if (descriptors_[start_idx + i]->updated) {
-                        image_set->insert(static_cast<ImageDescriptor *>(descriptors_[start_idx + i].get())->GetImageView());
+                        image_set->insert(static_cast<ImageDescriptor *>(descriptors_[start_idx + i])->GetImageView());
                         num_updates++;
                     }
                 }
             } else if (TexelBuffer == descriptors_[start_idx]->descriptor_class) {
                 for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
                     if (descriptors_[start_idx + i]->updated) {
-                        auto bufferview = static_cast<TexelDescriptor *>(descriptors_[start_idx + i].get())->GetBufferView();
+                        auto bufferview = static_cast<TexelDescriptor *>(descriptors_[start_idx + i])->GetBufferView();
                         auto bv_state = GetBufferViewState(device_data_, bufferview);
                         if (bv_state) {
                             buffer_set->insert(bv_state->create_info.buffer);
@@ -847,7 +886,7 @@ uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32
             } else if (GeneralBuffer == descriptors_[start_idx]->descriptor_class) {
                 for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
                     if (descriptors_[start_idx + i]->updated) {
-                        buffer_set->insert(static_cast<BufferDescriptor *>(descriptors_[start_idx + i].get())->GetBuffer());
+                        buffer_set->insert(static_cast<BufferDescriptor *>(descriptors_[start_idx + i])->GetBuffer());
                         num_updates++;
                     }
                 }
@@ -880,6 +919,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorS
         binding_being_updated++;
     }
     if (update->descriptorCount) some_update_ = true;
+    update_count_.fetch_add(1, std::memory_order_relaxed);
 
     if (!(p_layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
@@ -1057,8 +1097,8 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
     auto dst_start_idx = p_layout_->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
     // Update parameters all look good so perform update
     for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        auto src = src_set->descriptors_[src_start_idx + di].get();
-        auto dst = descriptors_[dst_start_idx + di].get();
+        auto src = src_set->descriptors_[src_start_idx + di];
+        auto dst = descriptors_[dst_start_idx + di];
         if (src->updated) {
             dst->CopyUpdate(src);
             some_update_ = true;
@@ -1066,6 +1106,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
             dst->updated = false;
         }
     }
+    update_count_.fetch_add(1, std::memory_order_relaxed);
 
     if (!(p_layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
@@ -1079,10 +1120,10 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
 void cvdescriptorset::DescriptorSet::BindCommandBuffer(GLOBAL_CB_NODE *cb_node,
                                                        const std::map<uint32_t, descriptor_req> &binding_req_map) {
     // bind cb to this descriptor set
-    cb_bindings.insert(cb_node);
+    core_validation::InsertCommandBufferBinding(&cb_bindings, cb_node);
     // Add bindings for descriptor set, the set's pool, and individual objects in the set
     cb_node->object_bindings.insert({HandleToUint64(set_), kVulkanObjectTypeDescriptorSet});
-    pool_state_->cb_bindings.insert(cb_node);
+    core_validation::InsertCommandBufferBinding(&pool_state_->cb_bindings, cb_node);
     cb_node->object_bindings.insert({HandleToUint64(pool_state_->pool), kVulkanObjectTypeDescriptorPool});
     // For the active slots, use set# to look up descriptorSet from boundDescriptorSets, and bind all of that descriptor set's
     // resources
@@ -1515,6 +1556,80 @@ void cvdescriptorset::TexelDescriptor::BindCommandBuffer(const layer_data *dev_d
     }
 }
 
+// Descriptor operations forward to the derived class named by descriptor_class
+void cvdescriptorset::Descriptor::WriteUpdate(const VkWriteDescriptorSet *update, const uint32_t index) {
+    switch (descriptor_class) {
+        case PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->WriteUpdate(update, index);
+        case ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->WriteUpdate(update, index);
+        case Image:
+            return static_cast<ImageDescriptor *>(this)->WriteUpdate(update, index);
+        case TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->WriteUpdate(update, index);
+        case GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->WriteUpdate(update, index);
+    }
+}
+
+void cvdescriptorset::Descriptor::CopyUpdate(const Descriptor *src) {
+    switch (descriptor_class) {
+        case PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->CopyUpdate(src);
+        case ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->CopyUpdate(src);
+        case Image:
+            return static_cast<ImageDescriptor *>(this)->CopyUpdate(src);
+        case TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->CopyUpdate(src);
+        case GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->CopyUpdate(src);
+    }
+}
+
+void cvdescriptorset::Descriptor::BindCommandBuffer(const layer_data *dev_data, GLOBAL_CB_NODE *cb_node) {
+    switch (descriptor_class) {
+        case PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->BindCommandBuffer(dev_data, cb_node);
+        case ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->BindCommandBuffer(dev_data, cb_node);
+        case Image:
+            return static_cast<ImageDescriptor *>(this)->BindCommandBuffer(dev_data, cb_node);
+        case TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->BindCommandBuffer(dev_data, cb_node);
+        case GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->BindCommandBuffer(dev_data, cb_node);
+    }
+}
+
+bool cvdescriptorset::Descriptor::IsImmutableSampler() const {
+    switch (descriptor_class) {
+        case PlainSampler:
+            return static_cast<const SamplerDescriptor *>(this)->IsImmutableSampler();
+        case ImageSampler:
+            return static_cast<const ImageSamplerDescriptor *>(this)->IsImmutableSampler();
+        default:
+            return false;
+    }
+}
+
+bool cvdescriptorset::Descriptor::IsDynamic() const {
+    return descriptor_class == GeneralBuffer && static_cast<const BufferDescriptor *>(this)->IsDynamic();
+}
+
+bool cvdescriptorset::Descriptor::IsStorage() const {
+    switch (descriptor_class) {
+        case Image:
+            return static_cast<const ImageDescriptor *>(this)->IsStorage();
+        case TexelBuffer:
+            return static_cast<const TexelDescriptor *>(this)->IsStorage();
+        case GeneralBuffer:
+            return static_cast<const BufferDescriptor *>(this)->IsStorage();
+        default:
+            return false;
+    }
+}
+
 // This is a helper function that iterates over a set of Write and Copy updates, pulls the DescriptorSet* for updated
 //  sets, and then calls their respective Validate[Write|Copy]Update functions.
 // If the update hits an issue for which the callback returns "true", meaning that the call down the chain should
@@ -1892,7 +2007,7 @@ bool cvdescriptorset::DescriptorSet::VerifyWriteUpdateContents(const VkWriteDesc
         // fall through
         case VK_DESCRIPTOR_TYPE_SAMPLER: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                if (!descriptors_[index + di].get()->IsImmutableSampler()) {
+                if (!descriptors_[index + di]->IsImmutableSampler()) {
                     if (!ValidateSampler(update->pImageInfo[di].sampler, device_data_)) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00325";
                         std::stringstream error_str;
@@ -1983,7 +2098,7 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
     switch (src_set->descriptors_[index]->descriptor_class) {
         case PlainSampler: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                const auto src_desc = src_set->descriptors_[index + di].get();
+                const auto src_desc = src_set->descriptors_[index + di];
                 if (!src_desc->updated) continue;
                 if (!src_desc->IsImmutableSampler()) {
                     auto update_sampler = static_cast<SamplerDescriptor *>(src_desc)->GetSampler();
@@ -2002,7 +2117,7 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
         }
         case ImageSampler: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                const auto src_desc = src_set->descriptors_[index + di].get();
+                const auto src_desc = src_set->descriptors_[index + di];
                 if (!src_desc->updated) continue;
                 auto img_samp_desc = static_cast<const ImageSamplerDescriptor *>(src_desc);
                 // First validate sampler
@@ -2032,7 +2147,7 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
         }
         case Image: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                const auto src_desc = src_set->descriptors_[index + di].get();
+                const auto src_desc = src_set->descriptors_[index + di];
                 if (!src_desc->updated) continue;
                 auto img_desc = static_cast<const ImageDescriptor *>(src_desc);
                 auto image_view = img_desc->GetImageView();
@@ -2048,7 +2163,7 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
         }
         case TexelBuffer: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                const auto src_desc = src_set->descriptors_[index + di].get();
+                const auto src_desc = src_set->descriptors_[index + di];
                 if (!src_desc->updated) continue;
                 auto buffer_view = static_cast<TexelDescriptor *>(src_desc)->GetBufferView();
                 auto bv_state = GetBufferViewState(device_data_, buffer_view);
@@ -2071,7 +2186,7 @@ bool cvdescriptorset::DescriptorSet::VerifyCopyUpdateContents(const VkCopyDescri
         }
         case GeneralBuffer: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                const auto src_desc = src_set->descriptors_[index + di].get();
+                const auto src_desc = src_set->descriptors_[index + di];
                 if (!src_desc->updated) continue;
                 auto buffer = static_cast<BufferDescriptor *>(src_desc)->GetBuffer();
                 if (!ValidateBufferUsage(GetBufferState(device_data_, buffer), type, error_code, error_msg)) {
@@ -2187,8 +2302,8 @@ bool cvdescriptorset::ValidateAllocateDescriptorSets(const core_validation::laye
 void cvdescriptorset::PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *p_alloc_info,
                                                     const VkDescriptorSet *descriptor_sets,
                                                     const AllocateDescriptorSetsData *ds_data,
-                                                    std::unordered_map<VkDescriptorPool, DESCRIPTOR_POOL_STATE *> *pool_map,
-                                                    std::unordered_map<VkDescriptorSet, cvdescriptorset::DescriptorSet *> *set_map,
+                                                    HandleMap<VkDescriptorPool, DESCRIPTOR_POOL_STATE *> *pool_map,
+                                                    HandleMap<VkDescriptorSet, cvdescriptorset::DescriptorSet *> *set_map,
                                                     layer_data *dev_data) {
     auto pool_state = (*pool_map)[p_alloc_info->descriptorPool];
     // Account for sets and individual descriptors allocated from pool
@@ -2204,8 +2319,8 @@ void cvdescriptorset::PerformAllocateDescriptorSets(const VkDescriptorSetAllocat
     for (uint32_t i = 0; i < p_alloc_info->descriptorSetCount; i++) {
         uint32_t variable_count = variable_count_valid ? variable_count_info->pDescriptorCounts[i] : 0;
 
-        auto new_ds = new cvdescriptorset::DescriptorSet(descriptor_sets[i], p_alloc_info->descriptorPool, ds_data->layout_nodes[i],
-                                                         variable_count, dev_data);
+        auto new_ds = pool_state->set_allocator.New(descriptor_sets[i], p_alloc_info->descriptorPool, ds_data->layout_nodes[i],
+                                                    variable_count, dev_data);
 
         pool_state->sets.insert(new_ds);
         new_ds->in_use.store(0);
@@ -30,6 +30,7 @@
 #include "vk_safe_struct.h"
 #include "vulkan/vk_layer.h"
 #include "vk_object_types.h"
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -285,9 +286,10 @@ class DescriptorSetLayout {
 
 /*
  * Descriptor classes
- *  Descriptor is an abstract base class from which 5 separate descriptor types are derived.
- *   This allows the WriteUpdate() and CopyUpdate() operations to be specialized per
- *   descriptor type, but all descriptors in a set can be accessed via the common Descriptor*.
+ *  Descriptor is the common base of 5 separate descriptor types. The WriteUpdate() and CopyUpdate() operations are
+ *   specialized per descriptor type, and all descriptors in a set can be accessed via the common Descriptor*. The
+ *   base class is not polymorphic: its operations switch on descriptor_class and forward to the derived type, so
+ *   that each DescriptorSet can keep its descriptors in one plain array per class.
  */
 
 // Slightly broader than type, each c++ "class" will has a corresponding "DescriptorClass"
@@ -295,18 +297,17 @@ enum DescriptorClass { PlainSampler, ImageSampler, Image, TexelBuffer, GeneralBu
 
 class Descriptor {
    public:
-    virtual ~Descriptor(){};
-    virtual void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t) = 0;
-    virtual void CopyUpdate(const Descriptor *) = 0;
+    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const Descriptor *);
     // Create binding between resources of this descriptor and given cb_node
-    virtual void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *) = 0;
-    virtual DescriptorClass GetClass() const { return descriptor_class; };
+    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *);
+    DescriptorClass GetClass() const { return descriptor_class; };
     // Special fast-path check for SamplerDescriptors that are immutable
-    virtual bool IsImmutableSampler() const { return false; };
+    bool IsImmutableSampler() const;
     // Check for dynamic descriptor type
-    virtual bool IsDynamic() const { return false; };
+    bool IsDynamic() const;
     // Check for storage descriptor type
-    virtual bool IsStorage() const { return false; };
+    bool IsStorage() const;
     bool updated;  // Has descriptor been updated?
     DescriptorClass descriptor_class;
 };
@@ -319,10 +320,10 @@ bool ValidateImageUpdate(VkImageView, VkImageLayout, VkDescriptorType, const cor
 class SamplerDescriptor : public Descriptor {
    public:
     SamplerDescriptor(const VkSampler *);
-    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const Descriptor *) override;
-    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *) override;
-    virtual bool IsImmutableSampler() const override { return immutable_; };
+    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const Descriptor *);
+    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *);
+    bool IsImmutableSampler() const { return immutable_; };
     VkSampler GetSampler() const { return sampler_; }
 
    private:
@@ -334,10 +335,10 @@ class SamplerDescriptor : public Descriptor {
 class ImageSamplerDescriptor : public Descriptor {
    public:
     ImageSamplerDescriptor(const VkSampler *);
-    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const Descriptor *) override;
-    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *) override;
-    virtual bool IsImmutableSampler() const override { return immutable_; };
+    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const Descriptor *);
+    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *);
+    bool IsImmutableSampler() const { return immutable_; };
     VkSampler GetSampler() const { return sampler_; }
     VkImageView GetImageView() const { return image_view_; }
     VkImageLayout GetImageLayout() const { return image_layout_; }
@@ -352,10 +353,10 @@ class ImageSamplerDescriptor : public Descriptor {
 class ImageDescriptor : public Descriptor {
    public:
     ImageDescriptor(const VkDescriptorType);
-    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const Descriptor *) override;
-    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *) override;
-    virtual bool IsStorage() const override { return storage_; }
+    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const Descriptor *);
+    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *);
+    bool IsStorage() const { return storage_; }
     VkImageView GetImageView() const { return image_view_; }
     VkImageLayout GetImageLayout() const { return image_layout_; }
 
@@ -368,10 +369,10 @@ class ImageDescriptor : public Descriptor {
 class TexelDescriptor : public Descriptor {
    public:
     TexelDescriptor(const VkDescriptorType);
-    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const Descriptor *) override;
-    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *) override;
-    virtual bool IsStorage() const override { return storage_; }
+    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const Descriptor *);
+    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *);
+    bool IsStorage() const { return storage_; }
     VkBufferView GetBufferView() const { return buffer_view_; }
 
    private:
@@ -382,11 +383,11 @@ class TexelDescriptor : public Descriptor {
 class BufferDescriptor : public Descriptor {
    public:
     BufferDescriptor(const VkDescriptorType);
-    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t) override;
-    void CopyUpdate(const Descriptor *) override;
-    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *) override;
-    virtual bool IsDynamic() const override { return dynamic_; }
-    virtual bool IsStorage() const override { return storage_; }
+    void WriteUpdate(const VkWriteDescriptorSet *, const uint32_t);
+    void CopyUpdate(const Descriptor *);
+    void BindCommandBuffer(const core_validation::layer_data *, GLOBAL_CB_NODE *);
+    bool IsDynamic() const { return dynamic_; }
+    bool IsStorage() const { return storage_; }
     VkBuffer GetBuffer() const { return buffer_; }
     VkDeviceSize GetOffset() const { return offset_; }
     VkDeviceSize GetRange() const { return range_; }
@@ -422,8 +423,8 @@ bool ValidateAllocateDescriptorSets(const core_validation::layer_data *, const V
                                     const AllocateDescriptorSetsData *);
 // Update state based on allocating new descriptorsets
 void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *, const VkDescriptorSet *, const AllocateDescriptorSetsData *,
-                                   std::unordered_map<VkDescriptorPool, DESCRIPTOR_POOL_STATE *> *,
-                                   std::unordered_map<VkDescriptorSet, cvdescriptorset::DescriptorSet *> *,
+                                   HandleMap<VkDescriptorPool, DESCRIPTOR_POOL_STATE *> *,
+                                   HandleMap<VkDescriptorSet, cvdescriptorset::DescriptorSet *> *,
                                    core_validation::layer_data *);
 
 /*
@@ -436,8 +437,9 @@ void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo *, const Vk
  *   Please refer to the DescriptorSetLayout comment above for a description of
  *   index, binding, and global index.
  *
- * At construction a vector of Descriptor* is created with types corresponding to the
- *   layout. The primary operation performed on the descriptors is to update them
+ * At construction the descriptors are created with types corresponding to the layout, in one
+ *   contiguous array per descriptor class, and a vector of Descriptor* indexes them by global index.
+ *   The primary operation performed on the descriptors is to update them
  *   via write or copy updates, and validate that the update contents are correct.
  *   In order to validate update contents, the DescriptorSet stores a bunch of ptrs
  *   to data maps where various Vulkan objects can be looked up. The management of
@@ -473,8 +475,8 @@ class DescriptorSet : public BASE_NODE {
                            const char *caller, std::string *) const;
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
-    uint32_t GetStorageUpdates(const std::map<uint32_t, descriptor_req> &, std::unordered_set<VkBuffer> *,
-                               std::unordered_set<VkImageView> *) const;
+    uint32_t GetStorageUpdates(const std::map<uint32_t, descriptor_req> &, RecyclingUnorderedSet<VkBuffer> *,
+                               RecyclingUnorderedSet<VkImageView> *) const;
 
     // Descriptor Update functions. These functions validate state and perform update separately
     // Validate contents of a WriteUpdate
@@ -519,6 +521,8 @@ class DescriptorSet : public BASE_NODE {
     };
     // Return true if any part of set has ever been updated
     bool IsUpdated() const { return some_update_; };
+    // Number of write or copy updates made to the set, for revalidating cached draw-time results
+    uint64_t GetUpdateCount() const { return update_count_.load(std::memory_order_relaxed); }
     bool IsPushDescriptor() const { return p_layout_->IsPushDescriptor(); };
     bool IsVariableDescriptorCount(uint32_t binding) const {
         return !!(p_layout_->GetDescriptorBindingFlagsFromBinding(binding) &
@@ -526,6 +530,8 @@ class DescriptorSet : public BASE_NODE {
     }
     uint32_t GetVariableDescriptorCount() const { return variable_count_; }
     DESCRIPTOR_POOL_STATE *GetPoolState() const { return pool_state_; }
+    // Set all bound cmd buffers to INVALID state
+    void InvalidateBoundCmdBuffers();
 
    private:
     bool VerifyWriteUpdateContents(const VkWriteDescriptorSet *, const uint32_t, std::string *, std::string *) const;
@@ -533,13 +539,19 @@ class DescriptorSet : public BASE_NODE {
                                   std::string *) const;
     bool ValidateBufferUsage(BUFFER_STATE const *, VkDescriptorType, std::string *, std::string *) const;
     bool ValidateBufferUpdate(VkDescriptorBufferInfo const *, VkDescriptorType, std::string *, std::string *) const;
-    // Private helper to set all bound cmd buffers to INVALID state
-    void InvalidateBoundCmdBuffers();
     bool some_update_;  // has any part of the set ever been updated?
+    std::atomic<uint64_t> update_count_;
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
     const std::shared_ptr<DescriptorSetLayout const> p_layout_;
-    std::vector<std::unique_ptr<Descriptor>> descriptors_;
+    // Descriptor storage, one array per class. These are sized once at construction and never grow, so the
+    // pointers in descriptors_ stay valid for the life of the set.
+    std::vector<SamplerDescriptor> sampler_descriptors_;
+    std::vector<ImageSamplerDescriptor> image_sampler_descriptors_;
+    std::vector<ImageDescriptor> image_descriptors_;
+    std::vector<TexelDescriptor> texel_descriptors_;
+    std::vector<BufferDescriptor> buffer_descriptors_;
+    std::vector<Descriptor *> descriptors_;  // Indexed by global index
     // Ptr to device data used for various data look-ups
     core_validation::layer_data *const device_data_;
     const VkPhysicalDeviceLimits limits_;
@@ -0,0 +1,156 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef HANDLE_WRAP_TABLE_H_
+#define HANDLE_WRAP_TABLE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Wrapped handle -> driver handle table with wait-free lookups.
+//
+// A wrapped handle encodes its own location: the low 32 bits are an index into a chunked slot array and the high 32 bits
+// are the slot's generation, bumped whenever the slot is released. Index 0 is never handed out, so no wrapped handle is
+// ever VK_NULL_HANDLE. Find is a couple of loads with no hashing and no lock; a handle that was never issued, or whose slot
+// has since been released (and possibly reissued), is reported as absent.
+//
+// Insert and Erase are serialized by an internal mutex. Released indices are reused, so the table is sized by the peak
+// number of live handles rather than by the number ever created. Chunks are never freed while the table exists, and the
+// chunk directory is replaced (not reallocated in place) when it grows, so a concurrent Find never touches freed memory.
+class HandleWrapTable {
+   public:
+    HandleWrapTable() : directory_(new Directory(kInitialChunks)), next_index_(1) {}
+    ~HandleWrapTable() {
+        Directory *directory = directory_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < directory->capacity; ++i) delete[] directory->chunks[i].load(std::memory_order_relaxed);
+        delete directory;
+        for (auto retired : retired_directories_) delete retired;
+    }
+    HandleWrapTable(const HandleWrapTable &) = delete;
+    HandleWrapTable &operator=(const HandleWrapTable &) = delete;
+
+    // Wait-free. Returns the driver handle wrapped by `wrapped`, or 0 if it is not a live wrapped handle.
+    uint64_t Find(uint64_t wrapped) const {
+        const Slot *slot = SlotFor(wrapped);
+        if (!slot) return 0;
+        // Validate the key on both sides of the value read so that a slot released and reissued in between is not
+        // mistaken for the one asked about. Only racy lookups (e.g. debug names on arbitrary handles) can hit that case.
+        if (slot->wrapped.load(std::memory_order_acquire) != wrapped) return 0;
+        const uint64_t handle = slot->handle.load(std::memory_order_acquire);
+        if (slot->wrapped.load(std::memory_order_relaxed) != wrapped) return 0;
+        return handle;
+    }
+
+    // Returns a new wrapped handle for `handle`
+    uint64_t Insert(uint64_t handle) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        uint32_t index;
+        if (!free_indices_.empty()) {
+            index = free_indices_.back();
+            free_indices_.pop_back();
+        } else {
+            index = next_index_++;
+            EnsureChunk(index >> kChunkBits);
+        }
+        Slot *slot = SlotAt(directory_.load(std::memory_order_relaxed), index);
+        const uint64_t wrapped = (uint64_t(slot->generation) << kIndexBits) | index;
+        slot->handle.store(handle, std::memory_order_release);
+        slot->wrapped.store(wrapped, std::memory_order_release);
+        return wrapped;
+    }
+
+    // Releases `wrapped` and returns the driver handle it wrapped, or 0 if it was not a live wrapped handle
+    uint64_t Erase(uint64_t wrapped) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        Slot *slot = SlotFor(wrapped);
+        if (!slot || slot->wrapped.load(std::memory_order_relaxed) != wrapped) return 0;
+        const uint64_t handle = slot->handle.load(std::memory_order_relaxed);
+        slot->wrapped.store(0, std::memory_order_release);
+        ++slot->generation;
+        free_indices_.push_back(static_cast<uint32_t>(wrapped & kIndexMask));
+        return handle;
+    }
+
+   private:
+    struct Slot {
+        Slot() : wrapped(0), handle(0), generation(0) {}
+        std::atomic<uint64_t> wrapped;  // 0 while the slot is free
+        std::atomic<uint64_t> handle;
+        uint32_t generation;            // Guarded by write_lock_
+    };
+
+    struct Directory {
+        explicit Directory(size_t cap) : capacity(cap), chunks(new std::atomic<Slot *>[cap]) {
+            for (size_t i = 0; i < capacity; ++i) chunks[i].store(nullptr, std::memory_order_relaxed);
+        }
+        ~Directory() { delete[] chunks; }
+        const size_t capacity;
+        std::atomic<Slot *> *chunks;
+    };
+
+    static const uint32_t kIndexBits = 32;
+    static const uint64_t kIndexMask = (uint64_t(1) << kIndexBits) - 1;
+    static const uint32_t kChunkBits = 10;
+    static const uint32_t kChunkSize = 1u << kChunkBits;
+    static const size_t kInitialChunks = 64;
+
+    static Slot *SlotAt(const Directory *directory, uint32_t index) {
+        return directory->chunks[index >> kChunkBits].load(std::memory_order_acquire) + (index & (kChunkSize - 1));
+    }
+
+    // Free slots hold a key of 0, so VK_NULL_HANDLE must be turned away here rather than matched against one
+    Slot *SlotFor(uint64_t wrapped) const {
+        if (!wrapped) return nullptr;
+        const uint64_t index = wrapped & kIndexMask;
+        const Directory *directory = directory_.load(std::memory_order_acquire);
+        const uint64_t chunk_index = index >> kChunkBits;
+        if (chunk_index >= directory->capacity) return nullptr;
+        Slot *chunk = directory->chunks[chunk_index].load(std::memory_order_acquire);
+        return chunk ? chunk + (index & (kChunkSize - 1)) : nullptr;
+    }
+
+    // Requires write_lock_
+    void EnsureChunk(size_t chunk_index) {
+        Directory *directory = directory_.load(std::memory_order_relaxed);
+        if (chunk_index >= directory->capacity) {
+            size_t capacity = directory->capacity * 2;
+            while (chunk_index >= capacity) capacity *= 2;
+            Directory *grown = new Directory(capacity);
+            for (size_t i = 0; i < directory->capacity; ++i) {
+                grown->chunks[i].store(directory->chunks[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            directory_.store(grown, std::memory_order_release);
+            // Readers may still be walking the old directory; it is only pointers, so keep it until destruction
+            retired_directories_.push_back(directory);
+            directory = grown;
+        }
+        if (!directory->chunks[chunk_index].load(std::memory_order_relaxed)) {
+            directory->chunks[chunk_index].store(new Slot[kChunkSize], std::memory_order_release);
+        }
+    }
+
+    std::atomic<Directory *> directory_;
+    std::mutex write_lock_;
+    uint32_t next_index_;                           // Guarded by write_lock_
+    std::vector<uint32_t> free_indices_;            // Guarded by write_lock_
+    std::vector<Directory *> retired_directories_;  // Guarded by write_lock_
+};
+
+#endif  // HANDLE_WRAP_TABLE_H_
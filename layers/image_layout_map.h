@@ -0,0 +1,191 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IMAGE_LAYOUT_MAP_H_
+#define IMAGE_LAYOUT_MAP_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include "vulkan/vulkan.h"
+
+// Per-image subresource state, stored as runs over a linear subresource index.
+//
+// Subresources are numbered aspect-major, then by mip level, then by array layer, using the image's own level and layer
+// counts. A range covering every layer of consecutive levels (or every level and layer of consecutive aspects) is
+// therefore contiguous, and adjacent subresources holding equal values share a single run. A whole-image barrier is one
+// map update per aspect rather than one hash insert per subresource.
+//
+// T must be copyable and equality comparable.
+template <typename T>
+class ImageSubresourceLayoutMap {
+   public:
+    typedef uint64_t Key;
+
+    ImageSubresourceLayoutMap() : mip_levels_(1), array_layers_(1) {}
+    // 3D images may have their depth slices addressed as layers (2D views, 2D_ARRAY_COMPATIBLE barriers), so those get
+    // a layer per slice.
+    explicit ImageSubresourceLayoutMap(VkImageCreateInfo const &ci)
+        : mip_levels_(std::max(ci.mipLevels, 1u)),
+          array_layers_(std::max(ci.imageType == VK_IMAGE_TYPE_3D ? std::max(ci.arrayLayers, ci.extent.depth) : ci.arrayLayers,
+                                 1u)) {}
+    // An empty map with the same geometry as another, so that keys can be exchanged between the two
+    template <typename U>
+    explicit ImageSubresourceLayoutMap(ImageSubresourceLayoutMap<U> const &geometry)
+        : mip_levels_(geometry.mip_levels()), array_layers_(geometry.array_layers()) {}
+
+    uint32_t mip_levels() const { return mip_levels_; }
+    uint32_t array_layers() const { return array_layers_; }
+    bool empty() const { return runs_.empty(); }
+    void clear() { runs_.clear(); }
+
+    Key Encode(uint32_t aspect_index, uint32_t level, uint32_t layer) const {
+        return (Key(aspect_index) * mip_levels_ + level) * array_layers_ + layer;
+    }
+    // The subresource (with a single aspect bit) a key refers to
+    VkImageSubresource Decode(Key key) const {
+        VkImageSubresource sub;
+        sub.arrayLayer = uint32_t(key % array_layers_);
+        key /= array_layers_;
+        sub.mipLevel = uint32_t(key % mip_levels_);
+        sub.aspectMask = VkImageAspectFlags(1u << uint32_t(key / mip_levels_));
+        return sub;
+    }
+
+    // Call fn(begin, end) for each half-open key range making up the given aspects of range. Levels and layers are
+    // clipped to the image, which also resolves VK_REMAINING_MIP_LEVELS / VK_REMAINING_ARRAY_LAYERS. Contiguous
+    // ranges are merged before being passed on.
+    template <typename Fn>
+    void ForEachKeyRange(VkImageAspectFlags aspect_mask, VkImageSubresourceRange const &range, Fn fn) const {
+        if (range.baseMipLevel >= mip_levels_ || range.baseArrayLayer >= array_layers_) return;
+        uint32_t level_count = std::min(range.levelCount, mip_levels_ - range.baseMipLevel);
+        uint32_t layer_count = std::min(range.layerCount, array_layers_ - range.baseArrayLayer);
+        bool whole_levels = layer_count == array_layers_;
+
+        Key pending_begin = 0, pending_end = 0;
+        for (uint32_t aspect_index = 0; aspect_index < 32 && (aspect_mask >> aspect_index); ++aspect_index) {
+            if (!(aspect_mask & (1u << aspect_index))) continue;
+            for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + level_count; ++level) {
+                Key begin = Encode(aspect_index, level, range.baseArrayLayer);
+                Key end = begin + (whole_levels ? Key(level_count) * array_layers_ : layer_count);
+                if (pending_end == begin && pending_begin != pending_end) {
+                    pending_end = end;
+                } else {
+                    if (pending_begin != pending_end) fn(pending_begin, pending_end);
+                    pending_begin = begin;
+                    pending_end = end;
+                }
+                if (whole_levels) break;
+            }
+        }
+        if (pending_begin != pending_end) fn(pending_begin, pending_end);
+    }
+
+    T const *Find(Key key) const {
+        auto it = runs_.upper_bound(key);
+        if (it == runs_.begin()) return nullptr;
+        --it;
+        return key < it->second.end ? &it->second.value : nullptr;
+    }
+
+    // Call fn(begin, end, value) for each piece of [begin, end), in order. value is nullptr for subresources with no entry.
+    template <typename Fn>
+    void ForEachPiece(Key begin, Key end, Fn fn) const {
+        if (begin >= end) return;
+        Key pos = begin;
+        auto it = runs_.upper_bound(begin);
+        if (it != runs_.begin() && std::prev(it)->second.end > begin) --it;
+        for (; it != runs_.end() && it->first < end; ++it) {
+            if (pos < it->first) {
+                fn(pos, it->first, static_cast<T const *>(nullptr));
+                pos = it->first;
+            }
+            Key piece_end = std::min(it->second.end, end);
+            fn(pos, piece_end, &it->second.value);
+            pos = piece_end;
+        }
+        if (pos < end) fn(pos, end, static_cast<T const *>(nullptr));
+    }
+
+    // Call fn(begin, end, value) for every stored run
+    template <typename Fn>
+    void ForEachRun(Fn fn) const {
+        for (auto const &run : runs_) fn(run.first, run.second.end, run.second.value);
+    }
+
+    // Replace the value of every subresource in [begin, end) with fn(current), where current is nullptr for subresources
+    // with no entry yet. fn is called once per existing run or gap, in order.
+    template <typename Fn>
+    void Update(Key begin, Key end, Fn fn) {
+        if (begin >= end) return;
+        Split(begin);
+        Split(end);
+        Key pos = begin;
+        auto it = runs_.lower_bound(begin);
+        for (; it != runs_.end() && it->first < end; ++it) {
+            if (pos < it->first) runs_.emplace_hint(it, pos, Run{it->first, fn(static_cast<T const *>(nullptr))});
+            T updated = fn(&it->second.value);
+            it->second.value = updated;
+            pos = it->second.end;
+        }
+        if (pos < end) runs_.emplace_hint(it, pos, Run{end, fn(static_cast<T const *>(nullptr))});
+        Coalesce(begin, end);
+    }
+
+    void Set(Key begin, Key end, T const &value) {
+        Update(begin, end, [&value](T const *) { return value; });
+    }
+
+   private:
+    struct Run {
+        Key end;
+        T value;
+    };
+
+    // Make key a run boundary, if it falls inside a run
+    void Split(Key key) {
+        auto it = runs_.upper_bound(key);
+        if (it == runs_.begin()) return;
+        --it;
+        if (it->first < key && key < it->second.end) {
+            runs_.emplace_hint(std::next(it), key, Run{it->second.end, it->second.value});
+            it->second.end = key;
+        }
+    }
+
+    // Merge touching runs with equal values, from the run before begin through the run starting at end
+    void Coalesce(Key begin, Key end) {
+        auto it = runs_.lower_bound(begin);
+        if (it != runs_.begin()) --it;
+        while (it != runs_.end() && it->first <= end) {
+            auto next = std::next(it);
+            if (next != runs_.end() && it->second.end == next->first && it->second.value == next->second.value) {
+                it->second.end = next->second.end;
+                runs_.erase(next);
+            } else {
+                it = next;
+            }
+        }
+    }
+
+    uint32_t mip_levels_;
+    uint32_t array_layers_;
+    std::map<Key, Run> runs_;  // Keyed by the first subresource of each run
+};
+
+#endif  // IMAGE_LAYOUT_MAP_H_
@@ -0,0 +1,433 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef LOCK_UTIL_H_
+#define LOCK_UTIL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Locking primitives for layers built as C++11 (i.e. without std::shared_mutex)
+namespace lock_util {
+
+// Reader/writer mutex. Satisfies Lockable for the exclusive side, so std::unique_lock and std::lock_guard work unchanged, and
+// provides lock_shared/unlock_shared for the reader side. Waiting writers block new readers, so a steady stream of shared
+// lockers cannot starve create/destroy/submit calls.
+class ReadWriteMutex {
+   public:
+    ReadWriteMutex() : readers_(0), waiting_writers_(0), writer_(false) {}
+    ReadWriteMutex(const ReadWriteMutex &) = delete;
+    ReadWriteMutex &operator=(const ReadWriteMutex &) = delete;
+
+    void lock() {
+        std::unique_lock<std::mutex> guard(mutex_);
+        ++waiting_writers_;
+        writer_cv_.wait(guard, [this]() { return !writer_ && (readers_ == 0); });
+        --waiting_writers_;
+        writer_ = true;
+    }
+
+    bool try_lock() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (writer_ || readers_) return false;
+        writer_ = true;
+        return true;
+    }
+
+    void unlock() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            writer_ = false;
+        }
+        // Wake everyone; a queued writer re-blocks the readers through waiting_writers_
+        writer_cv_.notify_one();
+        reader_cv_.notify_all();
+    }
+
+    void lock_shared() {
+        std::unique_lock<std::mutex> guard(mutex_);
+        reader_cv_.wait(guard, [this]() { return !writer_ && (waiting_writers_ == 0); });
+        ++readers_;
+    }
+
+    void unlock_shared() {
+        bool last_reader;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            last_reader = (--readers_ == 0);
+        }
+        if (last_reader) writer_cv_.notify_one();
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable reader_cv_;
+    std::condition_variable writer_cv_;
+    uint32_t readers_;
+    uint32_t waiting_writers_;
+    bool writer_;
+};
+
+// Fixed table of mutexes selected by address, for guarding objects reachable from many threads at once (e.g. the cb_bindings
+// of a state object shared by several command buffers) without a mutex member on every object.
+template <size_t N = 64>
+class StripedMutex {
+   public:
+    std::mutex &Get(const void *object) {
+        auto key = reinterpret_cast<uintptr_t>(object);
+        // Drop the low, alignment-dominated bits before folding
+        key ^= key >> 16;
+        return stripes_[(key >> 4) % N].mutex;
+    }
+
+   private:
+    // Keep stripes on separate cache lines so unrelated objects don't contend through false sharing
+    struct alignas(64) Stripe {
+        std::mutex mutex;
+    };
+    Stripe stripes_[N];
+};
+
+// Count of outstanding asynchronous work that other threads can wait out, e.g. before observing state the work will update.
+// Wait() is a single atomic load when nothing is outstanding.
+class PendingWork {
+   public:
+    PendingWork() : count_(0) {}
+    PendingWork(const PendingWork &) = delete;
+    PendingWork &operator=(const PendingWork &) = delete;
+
+    void Add() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Done() {
+        bool idle;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            idle = (count_.fetch_sub(1, std::memory_order_relaxed) == 1);
+        }
+        if (idle) idle_cv_.notify_all();
+    }
+
+    void Wait() {
+        if (count_.load(std::memory_order_acquire) == 0) return;
+        std::unique_lock<std::mutex> guard(mutex_);
+        idle_cv_.wait(guard, [this]() { return count_.load(std::memory_order_relaxed) == 0; });
+    }
+
+   private:
+    std::mutex mutex_;
+    std::condition_variable idle_cv_;
+    std::atomic<uint32_t> count_;
+};
+
+// Background thread running posted tasks one at a time, in posting order. Destruction runs whatever is still queued, then
+// joins.
+class SerialWorker {
+   public:
+    SerialWorker() : stop_(false), thread_(&SerialWorker::Run, this) {}
+    ~SerialWorker() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            stop_ = true;
+        }
+        task_cv_.notify_one();
+        thread_.join();
+    }
+    SerialWorker(const SerialWorker &) = delete;
+    SerialWorker &operator=(const SerialWorker &) = delete;
+
+    void Post(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        task_cv_.notify_one();
+    }
+
+   private:
+    void Run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> guard(mutex_);
+                task_cv_.wait(guard, [this]() { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable task_cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_;
+    // Last, so the thread starts only once everything it touches is constructed
+    std::thread thread_;
+};
+
+// Fixed set of threads for splitting a batch of independent work items. The calling thread works on the batch too.
+class WorkerPool {
+   public:
+    explicit WorkerPool(uint32_t thread_count) : stop_(false), generation_(0), job_(nullptr) {
+        for (uint32_t i = 0; i < thread_count; ++i) threads_.emplace_back(&WorkerPool::Run, this);
+    }
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto &thread : threads_) thread.join();
+    }
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Calls fn(i) once for every i in [0, count) and returns when all calls have finished. Calls may run in any order and on any
+    // pool thread. If another thread's batch already occupies the pool, this batch runs on the calling thread alone.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &fn) {
+        std::unique_lock<std::mutex> busy(busy_, std::try_to_lock);
+        if (!busy.owns_lock() || threads_.empty() || (count < 2)) {
+            for (uint32_t i = 0; i < count; ++i) fn(i);
+            return;
+        }
+
+        Job job(count, fn);
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            job_ = &job;
+            ++generation_;
+        }
+        work_cv_.notify_all();
+        job.Work();
+
+        // Workers can only join while job_ is published, so once it's withdrawn, waiting out the joined ones is enough
+        std::unique_lock<std::mutex> guard(mutex_);
+        job_ = nullptr;
+        done_cv_.wait(guard, [&job]() { return job.workers == 0; });
+    }
+
+   private:
+    struct Job {
+        Job(uint32_t count, const std::function<void(uint32_t)> &fn) : fn(fn), count(count), next(0), workers(0) {}
+        void Work() {
+            for (;;) {
+                const uint32_t i = next.fetch_add(1, std::memory_order_relaxed);
+                if (i >= count) return;
+                fn(i);
+            }
+        }
+        const std::function<void(uint32_t)> &fn;
+        const uint32_t count;
+        std::atomic<uint32_t> next;
+        uint32_t workers;  // Guarded by WorkerPool::mutex_
+    };
+
+    void Run() {
+        uint64_t seen = 0;
+        for (;;) {
+            Job *job;
+            {
+                std::unique_lock<std::mutex> guard(mutex_);
+                work_cv_.wait(guard, [this, seen]() { return stop_ || (job_ && (generation_ != seen)); });
+                if (stop_) return;
+                seen = generation_;
+                job = job_;
+                ++job->workers;
+            }
+            job->Work();
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                --job->workers;
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    std::mutex busy_;  // Held by the thread whose batch owns the pool
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    bool stop_;
+    uint64_t generation_;
+    Job *job_;
+    std::vector<std::thread> threads_;
+};
+
+// Epoch-based reclamation for lock-free readers (see ConcurrentUnorderedMap). A reader pins the current epoch for the
+// duration of its read-side section with an EpochGuard; a writer retires an unlinked object by tagging it with an epoch
+// taken after the unlink, and frees it once no reader pinned at or before that epoch remains. Pinning never waits.
+class EpochDomain {
+   public:
+    static EpochDomain &Get() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    void Pin() {
+        ThreadRecord &record = LocalRecord();
+        if (record.depth++ > 0) return;
+        if (!record.slot && !record.overflow) {
+            record.slot = ClaimSlot();
+            record.overflow = (record.slot == nullptr);
+        }
+        if (record.slot) {
+            record.slot->epoch.store(epoch_.load(std::memory_order_acquire), std::memory_order_seq_cst);
+        } else {
+            overflow_readers_.fetch_add(1, std::memory_order_seq_cst);
+        }
+        // Pairs with the fence in Advance(): either the writer sees this pin, or this reader sees the writer's unlink
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void Unpin() {
+        ThreadRecord &record = LocalRecord();
+        if (--record.depth > 0) return;
+        if (record.slot) {
+            record.slot->epoch.store(0, std::memory_order_release);
+        } else {
+            overflow_readers_.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Call after unlinking objects, returns their tag. One call can cover any number of objects unlinked before it.
+    uint64_t Advance() {
+        uint64_t tag = epoch_.fetch_add(1, std::memory_order_acq_rel);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return tag;
+    }
+
+    // Objects whose tag is below the returned epoch are unreachable. 0 (nothing is) while overflow readers are pinned.
+    uint64_t OldestPin() const {
+        if (overflow_readers_.load(std::memory_order_seq_cst)) return 0;
+        uint64_t oldest = UINT64_MAX;
+        for (const auto &slot : slots_) {
+            const uint64_t pinned = slot.epoch.load(std::memory_order_seq_cst);
+            if (pinned && (pinned < oldest)) oldest = pinned;
+        }
+        return oldest;
+    }
+
+   private:
+    // Epoch 0 marks an unpinned slot
+    EpochDomain() : epoch_(1), overflow_readers_(0) {}
+
+    static const size_t kReaderSlots = 128;
+    struct alignas(64) ReaderSlot {
+        ReaderSlot() : epoch(0), claimed(false) {}
+        std::atomic<uint64_t> epoch;
+        std::atomic<bool> claimed;
+    };
+
+    // Threads beyond kReaderSlots share overflow_readers_, which simply holds off reclamation while any of them is pinned
+    struct ThreadRecord {
+        ReaderSlot *slot = nullptr;
+        uint32_t depth = 0;
+        bool overflow = false;
+        ~ThreadRecord() {
+            if (slot) slot->claimed.store(false, std::memory_order_release);
+        }
+    };
+    static ThreadRecord &LocalRecord() {
+        static thread_local ThreadRecord record;
+        return record;
+    }
+
+    ReaderSlot *ClaimSlot() {
+        for (auto &slot : slots_) {
+            bool expected = false;
+            if (!slot.claimed.load(std::memory_order_relaxed) && slot.claimed.compare_exchange_strong(expected, true)) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    std::atomic<uint64_t> epoch_;
+    std::atomic<uint32_t> overflow_readers_;
+    ReaderSlot slots_[kReaderSlots];
+};
+
+// RAII read-side section for lock-free lookups
+class EpochGuard {
+   public:
+    EpochGuard() { EpochDomain::Get().Pin(); }
+    ~EpochGuard() { EpochDomain::Get().Unpin(); }
+    EpochGuard(const EpochGuard &) = delete;
+    EpochGuard &operator=(const EpochGuard &) = delete;
+};
+
+// Objects a writer has unlinked from lock-free readers' view, waiting to be freed. Retiring only appends; everything retired
+// since the last Reclaim() is tagged by a single EpochDomain::Advance() there, and one scan of the reader slots decides what
+// the whole list can free. No internal locking: the owner's writer lock covers it.
+template <typename T>
+class RetireList {
+   public:
+    RetireList() : untagged_(0) {}
+    RetireList(const RetireList &) = delete;
+    RetireList &operator=(const RetireList &) = delete;
+
+    void Retire(T item) {
+        items_.emplace_back(std::move(item), 0);
+        ++untagged_;
+    }
+    size_t size() const { return items_.size(); }
+
+    // Calls free(item) on every item no pinned reader can still reach
+    template <typename Free>
+    void Reclaim(Free &&free) {
+        if (items_.empty()) return;
+        EpochDomain &domain = EpochDomain::Get();
+        if (untagged_) {
+            const uint64_t tag = domain.Advance();
+            for (auto it = items_.end() - untagged_; it != items_.end(); ++it) it->second = tag;
+            untagged_ = 0;
+        }
+        const uint64_t oldest = domain.OldestPin();
+        // Tags never decrease along the list, so the first item still reachable holds back the rest
+        auto first_kept = items_.begin();
+        for (; (first_kept != items_.end()) && (first_kept->second < oldest); ++first_kept) free(first_kept->first);
+        items_.erase(items_.begin(), first_kept);
+    }
+
+    // For when no reader can remain, e.g. at the owner's destruction
+    template <typename Free>
+    void ReclaimAll(Free &&free) {
+        for (auto &item : items_) free(item.first);
+        items_.clear();
+        untagged_ = 0;
+    }
+
+   private:
+    std::vector<std::pair<T, uint64_t>> items_;
+    size_t untagged_;  // Items at the end of items_ retired since the last Reclaim()
+};
+
+}  // namespace lock_util
+
+#endif  // LOCK_UTIL_H_
@@ -131,7 +131,7 @@ struct layer_data {
     }
 };
 
-extern std::unordered_map<void *, layer_data *> layer_data_map;
+extern LayerDataMap<layer_data> layer_data_map;
 extern device_table_map ot_device_table_map;
 extern instance_table_map ot_instance_table_map;
 extern std::mutex global_lock;
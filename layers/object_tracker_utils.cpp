@@ -26,7 +26,7 @@
 
 namespace object_tracker {
 
-std::unordered_map<void *, layer_data *> layer_data_map;
+LayerDataMap<layer_data> layer_data_map;
 device_table_map ot_device_table_map;
 instance_table_map ot_instance_table_map;
 std::mutex global_lock;
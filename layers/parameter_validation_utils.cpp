@@ -96,8 +96,8 @@ extern bool parameter_validation_vkDestroyRenderPass(VkDevice device, VkRenderPa
 std::mutex global_lock;
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
-std::unordered_map<void *, layer_data *> layer_data_map;
-std::unordered_map<void *, instance_layer_data *> instance_layer_data_map;
+LayerDataMap<layer_data> layer_data_map;
+LayerDataMap<instance_layer_data> instance_layer_data_map;
 
 void InitializeManualParameterValidationFunctionPointers(void);
 
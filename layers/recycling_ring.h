@@ -0,0 +1,174 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef RECYCLING_RING_H_
+#define RECYCLING_RING_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Vector of trivially copyable elements holding up to N of them inline before spilling to the heap. clear() keeps whatever
+// capacity has been reached, so a recycled SmallVector refills without allocating. Move-only.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_destructible<T>::value, "SmallVector elements are copied and discarded bytewise");
+
+   public:
+    typedef T value_type;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+    SmallVector() : data_(inline_), size_(0), capacity_(N) {}
+    ~SmallVector() { Release(); }
+    SmallVector(const SmallVector &) = delete;
+    SmallVector &operator=(const SmallVector &) = delete;
+    SmallVector(SmallVector &&other) : data_(inline_), size_(0), capacity_(N) { Take(other); }
+    SmallVector &operator=(SmallVector &&other) {
+        if (this != &other) {
+            Release();
+            data_ = inline_;
+            size_ = 0;
+            capacity_ = N;
+            Take(other);
+        }
+        return *this;
+    }
+
+    void push_back(const T &value) {
+        if (size_ == capacity_) reserve(capacity_ * 2);
+        data_[size_++] = value;
+    }
+    void reserve(size_t capacity) {
+        if (capacity <= capacity_) return;
+        T *grown = static_cast<T *>(::operator new(capacity * sizeof(T)));
+        if (size_) std::memcpy(grown, data_, size_ * sizeof(T));
+        Release();
+        data_ = grown;
+        capacity_ = capacity;
+    }
+    void resize(size_t size, const T &value = T()) {
+        reserve(size);
+        for (size_t i = size_; i < size; ++i) data_[i] = value;
+        size_ = size;
+    }
+    void clear() { size_ = 0; }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+    T &operator[](size_t index) {
+        assert(index < size_);
+        return data_[index];
+    }
+    const T &operator[](size_t index) const {
+        assert(index < size_);
+        return data_[index];
+    }
+    T *data() { return data_; }
+    const T *data() const { return data_; }
+    iterator begin() { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+
+   private:
+    void Release() {
+        if (data_ != inline_) ::operator delete(data_);
+    }
+    // Requires this to be empty and inline
+    void Take(SmallVector &other) {
+        if (other.data_ == other.inline_) {
+            if (other.size_) std::memcpy(inline_, other.inline_, other.size_ * sizeof(T));
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_;
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    T *data_;
+    size_t size_;
+    size_t capacity_;
+    T inline_[N];
+};
+
+// FIFO of records that are recycled rather than destroyed. pop_front() clear()s the front record and leaves it in place for a
+// later emplace_back() to hand out again, so records that keep their capacity across clear() (e.g. built from SmallVector)
+// make a steady stream of pushes and pops allocation-free once the ring has grown to the number of records in flight.
+//
+// T must be default constructible, move assignable, and provide clear(). Records are addressed by their position from the
+// front; references are invalidated by emplace_back() when the ring grows.
+template <typename T>
+class RecyclingRing {
+   public:
+    explicit RecyclingRing(size_t initial_capacity = 16) : capacity_(1), head_(0), size_(0) {
+        while (capacity_ < initial_capacity) capacity_ *= 2;
+        slots_.reset(new T[capacity_]);
+    }
+    RecyclingRing(const RecyclingRing &) = delete;
+    RecyclingRing &operator=(const RecyclingRing &) = delete;
+
+    // Returns the new back record, empty as left by clear()
+    T &emplace_back() {
+        if (size_ == capacity_) Grow();
+        return slots_[(head_ + size_++) & (capacity_ - 1)];
+    }
+    void pop_front() {
+        assert(size_);
+        slots_[head_].clear();
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+
+    T &front() { return (*this)[0]; }
+    T &back() { return (*this)[size_ - 1]; }
+    T &operator[](size_t index) {
+        assert(index < size_);
+        return slots_[(head_ + index) & (capacity_ - 1)];
+    }
+    const T &operator[](size_t index) const {
+        assert(index < size_);
+        return slots_[(head_ + index) & (capacity_ - 1)];
+    }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+
+   private:
+    // Every slot moves over, live or not, so spare records keep the capacity they have built up
+    void Grow() {
+        std::unique_ptr<T[]> grown(new T[capacity_ * 2]);
+        for (size_t i = 0; i < capacity_; ++i) grown[i] = std::move(slots_[(head_ + i) & (capacity_ - 1)]);
+        slots_ = std::move(grown);
+        capacity_ *= 2;
+        head_ = 0;
+    }
+
+    std::unique_ptr<T[]> slots_;
+    size_t capacity_;  // Always a power of two
+    size_t head_;
+    size_t size_;
+};
+
+#endif  // RECYCLING_RING_H_
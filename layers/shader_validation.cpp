@@ -18,8 +18,10 @@
  * Author: Chris Forbes <chrisf@ijw.co.nz>
  */
 
+#include <algorithm>
 #include <cinttypes>
 #include <cassert>
+#include <cstddef>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -43,18 +45,6 @@ enum FORMAT_TYPE {
     FORMAT_TYPE_UINT = 4,
 };
 
-typedef std::pair<unsigned, unsigned> location_t;
-
-struct interface_var {
-    uint32_t id;
-    uint32_t type_id;
-    uint32_t offset;
-    bool is_patch;
-    bool is_block_member;
-    bool is_relaxed_precision;
-    // TODO: collect the name, too? Isn't required to be present.
-};
-
 struct shader_stage_attributes {
     char const *const name;
     bool arrayed_input;
@@ -68,6 +58,23 @@ static shader_stage_attributes shader_stage_attribs[] = {
 
 // SPIRV utility functions
 void shader_module::build_def_index() {
+    // Word 3 of the header is the id bound, and every id must lie below it. Modules that skipped spirv-val (shader validation
+    // disabled, or a validation cache hit) may declare any bound at all, so defs at or past the bound are dropped, and a bound
+    // far beyond what a module this size could use is indexed sparsely rather than allocated for. Every def takes at least
+    // two words, so a real module's bound stays within a small multiple of its size.
+    const uint32_t bound = words.size() > 3 ? words[3] : 0;
+    const bool dense = bound <= 2 * words.size();
+    def_index.assign(dense ? bound : 0, 0);
+    sparse_def_index.clear();
+    auto add_def = [this, bound, dense](uint32_t id, uint32_t offset) {
+        if (id >= bound) return;
+        if (dense) {
+            def_index[id] = offset;
+        } else {
+            sparse_def_index[id] = offset;
+        }
+    };
+
     for (auto insn : *this) {
         switch (insn.opcode()) {
             // Types
@@ -91,7 +98,7 @@ void shader_module::build_def_index() {
             case spv::OpTypeReserveId:
             case spv::OpTypeQueue:
             case spv::OpTypePipe:
-                def_index[insn.word(1)] = insn.offset();
+                add_def(insn.word(1), insn.offset());
                 break;
 
                 // Fixed constants
@@ -101,7 +108,7 @@ void shader_module::build_def_index() {
             case spv::OpConstantComposite:
             case spv::OpConstantSampler:
             case spv::OpConstantNull:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Specialization constants
@@ -110,17 +117,17 @@ void shader_module::build_def_index() {
             case spv::OpSpecConstant:
             case spv::OpSpecConstantComposite:
             case spv::OpSpecConstantOp:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Variables
             case spv::OpVariable:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
                 // Functions
             case spv::OpFunction:
-                def_index[insn.word(2)] = insn.offset();
+                add_def(insn.word(2), insn.offset());
                 break;
 
             default:
@@ -130,19 +137,14 @@ void shader_module::build_def_index() {
     }
 }
 
-static spirv_inst_iter find_entrypoint(shader_module const *src, char const *name, VkShaderStageFlagBits stageBits) {
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpEntryPoint) {
-            auto entrypointName = (char const *)&insn.word(3);
-            auto entrypointStageBits = 1u << insn.word(1);
-
-            if (!strcmp(entrypointName, name) && (entrypointStageBits & stageBits)) {
-                return insn;
-            }
+static shader_entrypoint const *find_entrypoint(shader_module const *src, char const *name, VkShaderStageFlagBits stageBits) {
+    for (auto const &entrypoint : src->entrypoints) {
+        if ((entrypoint.stage & stageBits) && entrypoint.name == name) {
+            return &entrypoint;
         }
     }
 
-    return src->end();
+    return nullptr;
 }
 
 static char const *storage_class_name(unsigned sc) {
@@ -343,14 +345,6 @@ static bool types_match(shader_module const *a, shader_module const *b, unsigned
     }
 }
 
-static unsigned value_or_default(std::unordered_map<unsigned, unsigned> const &map, unsigned id, unsigned def) {
-    auto it = map.find(id);
-    if (it == map.end())
-        return def;
-    else
-        return it->second;
-}
-
 static unsigned get_locations_consumed_by_type(shader_module const *src, unsigned type, bool strip_array_level) {
     auto insn = src->get_def(type);
     assert(insn != src->end());
@@ -455,67 +449,42 @@ static spirv_inst_iter get_struct_type(shader_module const *src, spirv_inst_iter
 }
 
 static bool collect_interface_block_members(shader_module const *src, std::map<location_t, interface_var> *out,
-                                            std::unordered_map<unsigned, unsigned> const &blocks, bool is_array_of_verts,
-                                            uint32_t id, uint32_t type_id, bool is_patch, int /*first_location*/) {
+                                            bool is_array_of_verts, uint32_t id, uint32_t type_id, bool is_patch) {
     // Walk down the type_id presented, trying to determine whether it's actually an interface block.
     auto type = get_struct_type(src, src->get_def(type_id), is_array_of_verts && !is_patch);
-    if (type == src->end() || blocks.find(type.word(1)) == blocks.end()) {
+    if (type == src->end() || !(src->get_decorations(type.word(1)).flags & decoration_set::block_bit)) {
         // This isn't an interface block.
         return false;
     }
 
-    std::unordered_map<unsigned, unsigned> member_components;
-    std::unordered_map<unsigned, unsigned> member_relaxed_precision;
-    std::unordered_map<unsigned, unsigned> member_patch;
-
-    // Walk all the OpMemberDecorate for type's result id -- first pass, collect components.
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-            unsigned member_index = insn.word(2);
-
-            if (insn.word(3) == spv::DecorationComponent) {
-                unsigned component = insn.word(4);
-                member_components[member_index] = component;
-            }
-
-            if (insn.word(3) == spv::DecorationRelaxedPrecision) {
-                member_relaxed_precision[member_index] = 1;
-            }
-
-            if (insn.word(3) == spv::DecorationPatch) {
-                member_patch[member_index] = 1;
-            }
-        }
-    }
+    auto members = src->member_decorations.find(type.word(1));
+    if (members == src->member_decorations.end()) return true;
 
     // TODO: correctly handle location assignment from outside
 
-    // Second pass -- produce the output, from Location decorations
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-            unsigned member_index = insn.word(2);
-            unsigned member_type_id = type.word(2 + member_index);
+    // Produce the output, from Location decorations
+    for (auto const &member : members->second) {
+        unsigned member_index = member.first;
+        auto const &decorations = member.second;
+        if (!(decorations.flags & decoration_set::location_bit)) continue;
 
-            if (insn.word(3) == spv::DecorationLocation) {
-                unsigned location = insn.word(4);
-                unsigned num_locations = get_locations_consumed_by_type(src, member_type_id, false);
-                auto component_it = member_components.find(member_index);
-                unsigned component = component_it == member_components.end() ? 0 : component_it->second;
-                bool is_relaxed_precision = member_relaxed_precision.find(member_index) != member_relaxed_precision.end();
-                bool member_is_patch = is_patch || member_patch.count(member_index) > 0;
+        unsigned member_type_id = type.word(2 + member_index);
+        unsigned location = decorations.location;
+        unsigned num_locations = get_locations_consumed_by_type(src, member_type_id, false);
+        unsigned component = decorations.component;
+        bool is_relaxed_precision = (decorations.flags & decoration_set::relaxed_precision_bit) != 0;
+        bool member_is_patch = is_patch || (decorations.flags & decoration_set::patch_bit);
 
-                for (unsigned int offset = 0; offset < num_locations; offset++) {
-                    interface_var v = {};
-                    v.id = id;
-                    // TODO: member index in interface_var too?
-                    v.type_id = member_type_id;
-                    v.offset = offset;
-                    v.is_patch = member_is_patch;
-                    v.is_block_member = true;
-                    v.is_relaxed_precision = is_relaxed_precision;
-                    (*out)[std::make_pair(location + offset, component)] = v;
-                }
-            }
+        for (unsigned int offset = 0; offset < num_locations; offset++) {
+            interface_var v = {};
+            v.id = id;
+            // TODO: member index in interface_var too?
+            v.type_id = member_type_id;
+            v.offset = offset;
+            v.is_patch = member_is_patch;
+            v.is_block_member = true;
+            v.is_relaxed_precision = is_relaxed_precision;
+            (*out)[std::make_pair(location + offset, component)] = v;
         }
     }
 
@@ -524,43 +493,6 @@ static bool collect_interface_block_members(shader_module const *src, std::map<l
 
 static std::map<location_t, interface_var> collect_interface_by_location(shader_module const *src, spirv_inst_iter entrypoint,
                                                                          spv::StorageClass sinterface, bool is_array_of_verts) {
-    std::unordered_map<unsigned, unsigned> var_locations;
-    std::unordered_map<unsigned, unsigned> var_builtins;
-    std::unordered_map<unsigned, unsigned> var_components;
-    std::unordered_map<unsigned, unsigned> blocks;
-    std::unordered_map<unsigned, unsigned> var_patch;
-    std::unordered_map<unsigned, unsigned> var_relaxed_precision;
-
-    for (auto insn : *src) {
-        // We consider two interface models: SSO rendezvous-by-location, and builtins. Complain about anything that
-        // fits neither model.
-        if (insn.opcode() == spv::OpDecorate) {
-            if (insn.word(2) == spv::DecorationLocation) {
-                var_locations[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationBuiltIn) {
-                var_builtins[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationComponent) {
-                var_components[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationBlock) {
-                blocks[insn.word(1)] = 1;
-            }
-
-            if (insn.word(2) == spv::DecorationPatch) {
-                var_patch[insn.word(1)] = 1;
-            }
-
-            if (insn.word(2) == spv::DecorationRelaxedPrecision) {
-                var_relaxed_precision[insn.word(1)] = 1;
-            }
-        }
-    }
-
     // TODO: handle grouped decorations
     // TODO: handle index=1 dual source outputs from FS -- two vars will have the same location, and we DON'T want to clobber.
 
@@ -583,15 +515,17 @@ static std::map<location_t, interface_var> collect_interface_by_location(shader_
             unsigned id = insn.word(2);
             unsigned type = insn.word(1);
 
-            int location = value_or_default(var_locations, id, static_cast<unsigned>(-1));
-            int builtin = value_or_default(var_builtins, id, static_cast<unsigned>(-1));
-            unsigned component = value_or_default(var_components, id, 0);  // Unspecified is OK, is 0
-            bool is_patch = var_patch.find(id) != var_patch.end();
-            bool is_relaxed_precision = var_relaxed_precision.find(id) != var_relaxed_precision.end();
+            // We consider two interface models: SSO rendezvous-by-location, and builtins. Complain about anything that
+            // fits neither model.
+            auto const &decorations = src->get_decorations(id);
+            int location = (decorations.flags & decoration_set::location_bit) ? decorations.location : -1;
+            unsigned component = decorations.component;  // Unspecified is OK, is 0
+            bool is_patch = (decorations.flags & decoration_set::patch_bit) != 0;
+            bool is_relaxed_precision = (decorations.flags & decoration_set::relaxed_precision_bit) != 0;
 
-            if (builtin != -1)
+            if (decorations.flags & decoration_set::builtin_bit)
                 continue;
-            else if (!collect_interface_block_members(src, &out, blocks, is_array_of_verts, id, type, is_patch, location)) {
+            else if (!collect_interface_block_members(src, &out, is_array_of_verts, id, type, is_patch)) {
                 // A user-defined interface variable, with a location. Where a variable occupied multiple locations, emit
                 // one result for each.
                 unsigned num_locations = get_locations_consumed_by_type(src, type, is_array_of_verts && !is_patch);
@@ -612,29 +546,24 @@ static std::map<location_t, interface_var> collect_interface_by_location(shader_
 }
 
 static std::vector<std::pair<uint32_t, interface_var>> collect_interface_by_input_attachment_index(
-    shader_module const *src, std::unordered_set<uint32_t> const &accessible_ids) {
+    shader_module const *src, std::vector<uint32_t> const &accessible_ids) {
     std::vector<std::pair<uint32_t, interface_var>> out;
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpDecorate) {
-            if (insn.word(2) == spv::DecorationInputAttachmentIndex) {
-                auto attachment_index = insn.word(3);
-                auto id = insn.word(1);
-
-                if (accessible_ids.count(id)) {
-                    auto def = src->get_def(id);
-                    assert(def != src->end());
-
-                    if (def.opcode() == spv::OpVariable && insn.word(3) == spv::StorageClassUniformConstant) {
-                        auto num_locations = get_locations_consumed_by_type(src, def.word(1), false);
-                        for (unsigned int offset = 0; offset < num_locations; offset++) {
-                            interface_var v = {};
-                            v.id = id;
-                            v.type_id = def.word(1);
-                            v.offset = offset;
-                            out.emplace_back(attachment_index + offset, v);
-                        }
-                    }
+    for (auto id : accessible_ids) {
+        auto const &decorations = src->get_decorations(id);
+        if (decorations.flags & decoration_set::input_attachment_index_bit) {
+            auto attachment_index = decorations.input_attachment_index;
+            auto def = src->get_def(id);
+            assert(def != src->end());
+
+            if (def.opcode() == spv::OpVariable && def.word(3) == spv::StorageClassUniformConstant) {
+                auto num_locations = get_locations_consumed_by_type(src, def.word(1), false);
+                for (unsigned int offset = 0; offset < num_locations; offset++) {
+                    interface_var v = {};
+                    v.id = id;
+                    v.type_id = def.word(1);
+                    v.offset = offset;
+                    out.emplace_back(attachment_index + offset, v);
                 }
             }
         }
@@ -666,61 +595,35 @@ static bool is_writable_descriptor_type(shader_module const *module, uint32_t ty
         }
 
         case spv::OpTypeStruct:
-            for (auto insn : *module) {
-                if (insn.opcode() == spv::OpDecorate && insn.word(1) == type.word(1)) {
-                    if (insn.word(2) == spv::DecorationBufferBlock) {
-                        return true;
-                    }
-                }
-            }
+            return (module->get_decorations(type.word(1)).flags & decoration_set::buffer_block_bit) != 0;
     }
 
     return false;
 }
 
 static std::vector<std::pair<descriptor_slot_t, interface_var>> collect_interface_by_descriptor_slot(
-    debug_report_data const *report_data, shader_module const *src, std::unordered_set<uint32_t> const &accessible_ids,
-    bool *has_writable_descriptor) {
-    std::unordered_map<unsigned, unsigned> var_sets;
-    std::unordered_map<unsigned, unsigned> var_bindings;
-    std::unordered_map<unsigned, unsigned> var_nonwritable;
-
-    for (auto insn : *src) {
-        // All variables in the Uniform or UniformConstant storage classes are required to be decorated with both
-        // DecorationDescriptorSet and DecorationBinding.
-        if (insn.opcode() == spv::OpDecorate) {
-            if (insn.word(2) == spv::DecorationDescriptorSet) {
-                var_sets[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationBinding) {
-                var_bindings[insn.word(1)] = insn.word(3);
-            }
-
-            if (insn.word(2) == spv::DecorationNonWritable) {
-                var_nonwritable[insn.word(1)] = 1;
-            }
-        }
-    }
-
+    shader_module const *src, std::vector<uint32_t> const &accessible_ids, bool *has_writable_descriptor) {
     std::vector<std::pair<descriptor_slot_t, interface_var>> out;
 
     for (auto id : accessible_ids) {
         auto insn = src->get_def(id);
         assert(insn != src->end());
 
+        // All variables in the Uniform or UniformConstant storage classes are required to be decorated with both
+        // DecorationDescriptorSet and DecorationBinding.
         if (insn.opcode() == spv::OpVariable &&
             (insn.word(3) == spv::StorageClassUniform || insn.word(3) == spv::StorageClassUniformConstant ||
              insn.word(3) == spv::StorageClassStorageBuffer)) {
-            unsigned set = value_or_default(var_sets, insn.word(2), 0);
-            unsigned binding = value_or_default(var_bindings, insn.word(2), 0);
+            auto const &decorations = src->get_decorations(insn.word(2));
+            unsigned set = decorations.descriptor_set;
+            unsigned binding = decorations.binding;
 
             interface_var v = {};
             v.id = insn.word(2);
             v.type_id = insn.word(1);
             out.emplace_back(std::make_pair(set, binding), v);
 
-            if (var_nonwritable.find(id) == var_nonwritable.end() && is_writable_descriptor_type(src, insn.word(1))) {
+            if (!(decorations.flags & decoration_set::nonwritable_bit) && is_writable_descriptor_type(src, insn.word(1))) {
                 *has_writable_descriptor = true;
             }
         }
@@ -752,10 +655,10 @@ static bool validate_vi_consistency(debug_report_data const *report_data, VkPipe
 }
 
 static bool validate_vi_against_vs_inputs(debug_report_data const *report_data, VkPipelineVertexInputStateCreateInfo const *vi,
-                                          shader_module const *vs, spirv_inst_iter entrypoint) {
+                                          shader_module const *vs, shader_entrypoint const *entrypoint) {
     bool skip = false;
 
-    auto inputs = collect_interface_by_location(vs, entrypoint, spv::StorageClassInput, false);
+    auto const &inputs = entrypoint->inputs;
 
     // Build index by location
     std::map<uint32_t, VkVertexInputAttributeDescription const *> attribs;
@@ -813,7 +716,7 @@ static bool validate_vi_against_vs_inputs(debug_report_data const *report_data,
 }
 
 static bool validate_fs_outputs_against_render_pass(debug_report_data const *report_data, shader_module const *fs,
-                                                    spirv_inst_iter entrypoint, PIPELINE_STATE const *pipeline,
+                                                    shader_entrypoint const *entrypoint, PIPELINE_STATE const *pipeline,
                                                     uint32_t subpass_index) {
     auto rpci = pipeline->rp_state->createInfo.ptr();
 
@@ -831,7 +734,7 @@ static bool validate_fs_outputs_against_render_pass(debug_report_data const *rep
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
 
-    auto outputs = collect_interface_by_location(fs, entrypoint, spv::StorageClassOutput, false);
+    auto const &outputs = entrypoint->outputs;
 
     auto it_a = outputs.begin();
     auto it_b = color_attachments.begin();
@@ -884,7 +787,7 @@ static bool validate_fs_outputs_against_render_pass(debug_report_data const *rep
 //
 // TODO: The set of interesting opcodes here was determined by eyeballing the SPIRV spec. It might be worth
 // converting parts of this to be generated from the machine-readable spec instead.
-static std::unordered_set<uint32_t> mark_accessible_ids(shader_module const *src, spirv_inst_iter entrypoint) {
+static std::vector<uint32_t> mark_accessible_ids(shader_module const *src, spirv_inst_iter entrypoint) {
     std::unordered_set<uint32_t> ids;
     std::unordered_set<uint32_t> worklist;
     worklist.insert(entrypoint.word(2));
@@ -992,7 +895,126 @@ static std::unordered_set<uint32_t> mark_accessible_ids(shader_module const *src
         }
     }
 
-    return ids;
+    std::vector<uint32_t> sorted_ids(ids.begin(), ids.end());
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    return sorted_ids;
+}
+
+// Walk the module once, collecting the decorations, capabilities and per-entrypoint interfaces that pipeline validation
+// consults. Every pipeline which uses the module then reads these instead of rescanning the instruction stream.
+void shader_module::build_reflection() {
+    std::vector<spirv_inst_iter> entrypoint_insns;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> execution_modes;
+
+    for (auto insn : *this) {
+        switch (insn.opcode()) {
+            case spv::OpCapability:
+                capabilities.push_back(insn.word(1));
+                break;
+
+            case spv::OpEntryPoint:
+                entrypoint_insns.push_back(insn);
+                break;
+
+            case spv::OpExecutionMode:
+                execution_modes[insn.word(1)].push_back(insn.word(2));
+                break;
+
+            case spv::OpDecorate: {
+                auto &d = decorations[insn.word(1)];
+                switch (insn.word(2)) {
+                    case spv::DecorationLocation:
+                        d.flags |= decoration_set::location_bit;
+                        d.location = insn.word(3);
+                        break;
+                    case spv::DecorationComponent:
+                        d.component = insn.word(3);
+                        break;
+                    case spv::DecorationBuiltIn:
+                        d.flags |= decoration_set::builtin_bit;
+                        break;
+                    case spv::DecorationBlock:
+                        d.flags |= decoration_set::block_bit;
+                        break;
+                    case spv::DecorationBufferBlock:
+                        d.flags |= decoration_set::buffer_block_bit;
+                        break;
+                    case spv::DecorationPatch:
+                        d.flags |= decoration_set::patch_bit;
+                        break;
+                    case spv::DecorationRelaxedPrecision:
+                        d.flags |= decoration_set::relaxed_precision_bit;
+                        break;
+                    case spv::DecorationNonWritable:
+                        d.flags |= decoration_set::nonwritable_bit;
+                        break;
+                    case spv::DecorationInputAttachmentIndex:
+                        d.flags |= decoration_set::input_attachment_index_bit;
+                        d.input_attachment_index = insn.word(3);
+                        break;
+                    case spv::DecorationDescriptorSet:
+                        d.descriptor_set = insn.word(3);
+                        break;
+                    case spv::DecorationBinding:
+                        d.binding = insn.word(3);
+                        break;
+                }
+                break;
+            }
+
+            case spv::OpMemberDecorate: {
+                auto &d = member_decorations[insn.word(1)][insn.word(2)];
+                switch (insn.word(3)) {
+                    case spv::DecorationLocation:
+                        d.flags |= decoration_set::location_bit;
+                        d.location = insn.word(4);
+                        break;
+                    case spv::DecorationComponent:
+                        d.component = insn.word(4);
+                        break;
+                    case spv::DecorationBuiltIn:
+                        d.flags |= decoration_set::builtin_bit;
+                        break;
+                    case spv::DecorationPatch:
+                        d.flags |= decoration_set::patch_bit;
+                        break;
+                    case spv::DecorationRelaxedPrecision:
+                        d.flags |= decoration_set::relaxed_precision_bit;
+                        break;
+                    case spv::DecorationOffset:
+                        d.flags |= decoration_set::offset_bit;
+                        d.offset = insn.word(4);
+                        break;
+                }
+                break;
+            }
+        }
+    }
+
+    entrypoints.reserve(entrypoint_insns.size());
+    for (auto insn : entrypoint_insns) {
+        shader_entrypoint entrypoint;
+        entrypoint.name = (char const *)&insn.word(3);
+        entrypoint.stage = VkShaderStageFlagBits(1u << insn.word(1));
+        entrypoint.id = insn.word(2);
+        entrypoint.execution_modes = execution_modes[entrypoint.id];
+        entrypoint.accessible_ids = mark_accessible_ids(this, insn);
+        entrypoint.has_writable_descriptor = false;
+        entrypoint.descriptor_uses =
+            collect_interface_by_descriptor_slot(this, entrypoint.accessible_ids, &entrypoint.has_writable_descriptor);
+
+        if (entrypoint.stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+            entrypoint.input_attachment_uses = collect_interface_by_input_attachment_index(this, entrypoint.accessible_ids);
+        }
+
+        if (entrypoint.stage & VK_SHADER_STAGE_ALL_GRAPHICS) {
+            auto const &attribs = shader_stage_attribs[get_shader_stage_id(entrypoint.stage)];
+            entrypoint.inputs = collect_interface_by_location(this, insn, spv::StorageClassInput, attribs.arrayed_input);
+            entrypoint.outputs = collect_interface_by_location(this, insn, spv::StorageClassOutput, attribs.arrayed_output);
+        }
+
+        entrypoints.push_back(std::move(entrypoint));
+    }
 }
 
 static bool validate_push_constant_block_against_pipeline(debug_report_data const *report_data,
@@ -1005,38 +1027,38 @@ static bool validate_push_constant_block_against_pipeline(debug_report_data cons
     type = get_struct_type(src, type, false);
     assert(type != src->end());
 
+    auto members = src->member_decorations.find(type.word(1));
+    if (members == src->member_decorations.end()) return false;
+
     // Validate directly off the offsets. this isn't quite correct for arrays and matrices, but is a good first step.
     // TODO: arrays, matrices, weird sizes
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpMemberDecorate && insn.word(1) == type.word(1)) {
-            if (insn.word(3) == spv::DecorationOffset) {
-                unsigned offset = insn.word(4);
-                auto size = 4;  // Bytes; TODO: calculate this based on the type
-
-                bool found_range = false;
-                for (auto const &range : *push_constant_ranges) {
-                    if (range.offset <= offset && range.offset + range.size >= offset + size) {
-                        found_range = true;
-
-                        if ((range.stageFlags & stage) == 0) {
-                            skip |=
-                                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                        SHADER_CHECKER_PUSH_CONSTANT_NOT_ACCESSIBLE_FROM_STAGE,
-                                        "Push constant range covering variable starting at offset %u not accessible from stage %s",
-                                        offset, string_VkShaderStageFlagBits(stage));
-                        }
+    for (auto const &member : members->second) {
+        if (!(member.second.flags & decoration_set::offset_bit)) continue;
 
-                        break;
-                    }
-                }
+        unsigned offset = member.second.offset;
+        auto size = 4;  // Bytes; TODO: calculate this based on the type
+
+        bool found_range = false;
+        for (auto const &range : *push_constant_ranges) {
+            if (range.offset <= offset && range.offset + range.size >= offset + size) {
+                found_range = true;
 
-                if (!found_range) {
+                if ((range.stageFlags & stage) == 0) {
                     skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                    SHADER_CHECKER_PUSH_CONSTANT_OUT_OF_RANGE,
-                                    "Push constant range covering variable starting at offset %u not declared in layout", offset);
+                                    SHADER_CHECKER_PUSH_CONSTANT_NOT_ACCESSIBLE_FROM_STAGE,
+                                    "Push constant range covering variable starting at offset %u not accessible from stage %s",
+                                    offset, string_VkShaderStageFlagBits(stage));
                 }
+
+                break;
             }
         }
+
+        if (!found_range) {
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                            SHADER_CHECKER_PUSH_CONSTANT_OUT_OF_RANGE,
+                            "Push constant range covering variable starting at offset %u not declared in layout", offset);
+        }
     }
 
     return skip;
@@ -1044,7 +1066,7 @@ static bool validate_push_constant_block_against_pipeline(debug_report_data cons
 
 static bool validate_push_constant_usage(debug_report_data const *report_data,
                                          std::vector<VkPushConstantRange> const *push_constant_ranges, shader_module const *src,
-                                         std::unordered_set<uint32_t> accessible_ids, VkShaderStageFlagBits stage) {
+                                         std::vector<uint32_t> const &accessible_ids, VkShaderStageFlagBits stage) {
     bool skip = false;
 
     for (auto id : accessible_ids) {
@@ -1105,21 +1127,18 @@ static bool descriptor_type_match(shader_module const *module, uint32_t type_id,
 
     switch (type.opcode()) {
         case spv::OpTypeStruct: {
-            for (auto insn : *module) {
-                if (insn.opcode() == spv::OpDecorate && insn.word(1) == type.word(1)) {
-                    if (insn.word(2) == spv::DecorationBlock) {
-                        if (is_storage_buffer) {
-                            return descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
-                                   descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
-                        } else {
-                            return descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
-                                   descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-                        }
-                    } else if (insn.word(2) == spv::DecorationBufferBlock) {
-                        return descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
-                               descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
-                    }
+            auto const &decorations = module->get_decorations(type.word(1));
+            if (decorations.flags & decoration_set::block_bit) {
+                if (is_storage_buffer) {
+                    return descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+                           descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+                } else {
+                    return descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+                           descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
                 }
+            } else if (decorations.flags & decoration_set::buffer_block_bit) {
+                return descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+                       descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
             }
 
             // Invalid
@@ -1285,48 +1304,46 @@ static bool validate_shader_capabilities(layer_data *dev_data, shader_module con
     };
     // clang-format on
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpCapability) {
-            size_t n = capabilities.count(insn.word(1));
-            if (1 == n) {  // key occurs exactly once
-                auto it = capabilities.find(insn.word(1));
-                if (it != capabilities.end()) {
-                    if (it->second.feature) {
-                        skip |= require_feature(report_data, *(it->second.feature), it->second.name);
-                    }
-                    if (it->second.extension) {
-                        skip |= require_extension(report_data, *(it->second.extension), it->second.name);
-                    }
+    for (auto capability : src->capabilities) {
+        size_t n = capabilities.count(capability);
+        if (1 == n) {  // key occurs exactly once
+            auto it = capabilities.find(capability);
+            if (it != capabilities.end()) {
+                if (it->second.feature) {
+                    skip |= require_feature(report_data, *(it->second.feature), it->second.name);
                 }
-            } else if (1 < n) {  // key occurs multiple times, at least one must be enabled
-                bool needs_feature = false, has_feature = false;
-                bool needs_ext = false, has_ext = false;
-                std::string feature_names = "(one of) [ ";
-                std::string extension_names = feature_names;
-                auto caps = capabilities.equal_range(insn.word(1));
-                for (auto it = caps.first; it != caps.second; ++it) {
-                    if (it->second.feature) {
-                        needs_feature = true;
-                        has_feature = has_feature || *(it->second.feature);
-                        feature_names += it->second.name;
-                        feature_names += " ";
-                    }
-                    if (it->second.extension) {
-                        needs_ext = true;
-                        has_ext = has_ext || *(it->second.extension);
-                        extension_names += it->second.name;
-                        extension_names += " ";
-                    }
+                if (it->second.extension) {
+                    skip |= require_extension(report_data, *(it->second.extension), it->second.name);
                 }
-                if (needs_feature) {
-                    feature_names += "]";
-                    skip |= require_feature(report_data, has_feature, feature_names.c_str());
+            }
+        } else if (1 < n) {  // key occurs multiple times, at least one must be enabled
+            bool needs_feature = false, has_feature = false;
+            bool needs_ext = false, has_ext = false;
+            std::string feature_names = "(one of) [ ";
+            std::string extension_names = feature_names;
+            auto caps = capabilities.equal_range(capability);
+            for (auto it = caps.first; it != caps.second; ++it) {
+                if (it->second.feature) {
+                    needs_feature = true;
+                    has_feature = has_feature || *(it->second.feature);
+                    feature_names += it->second.name;
+                    feature_names += " ";
                 }
-                if (needs_ext) {
-                    extension_names += "]";
-                    skip |= require_extension(report_data, has_ext, extension_names.c_str());
+                if (it->second.extension) {
+                    needs_ext = true;
+                    has_ext = has_ext || *(it->second.extension);
+                    extension_names += it->second.name;
+                    extension_names += " ";
                 }
             }
+            if (needs_feature) {
+                feature_names += "]";
+                skip |= require_feature(report_data, has_feature, feature_names.c_str());
+            }
+            if (needs_ext) {
+                extension_names += "]";
+                skip |= require_extension(report_data, has_ext, extension_names.c_str());
+            }
         }
     }
 
@@ -1399,33 +1416,30 @@ static VkDescriptorSetLayoutBinding const *get_descriptor_binding(PIPELINE_LAYOU
     return pipelineLayout->set_layouts[slot.first]->GetDescriptorSetLayoutBindingPtrFromBinding(slot.second);
 }
 
-static void process_execution_modes(shader_module const *src, spirv_inst_iter entrypoint, PIPELINE_STATE *pipeline) {
-    auto entrypoint_id = entrypoint.word(1);
+static void process_execution_modes(shader_entrypoint const *entrypoint, PIPELINE_STATE *pipeline) {
     bool is_point_mode = false;
 
-    for (auto insn : *src) {
-        if (insn.opcode() == spv::OpExecutionMode && insn.word(1) == entrypoint_id) {
-            switch (insn.word(2)) {
-                case spv::ExecutionModePointMode:
-                    // In tessellation shaders, PointMode is separate and trumps the tessellation topology.
-                    is_point_mode = true;
-                    break;
-
-                case spv::ExecutionModeOutputPoints:
-                    pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
-                    break;
-
-                case spv::ExecutionModeIsolines:
-                case spv::ExecutionModeOutputLineStrip:
-                    pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
-                    break;
-
-                case spv::ExecutionModeTriangles:
-                case spv::ExecutionModeQuads:
-                case spv::ExecutionModeOutputTriangleStrip:
-                    pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
-                    break;
-            }
+    for (auto mode : entrypoint->execution_modes) {
+        switch (mode) {
+            case spv::ExecutionModePointMode:
+                // In tessellation shaders, PointMode is separate and trumps the tessellation topology.
+                is_point_mode = true;
+                break;
+
+            case spv::ExecutionModeOutputPoints:
+                pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+                break;
+
+            case spv::ExecutionModeIsolines:
+            case spv::ExecutionModeOutputLineStrip:
+                pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
+                break;
+
+            case spv::ExecutionModeTriangles:
+            case spv::ExecutionModeQuads:
+            case spv::ExecutionModeOutputTriangleStrip:
+                pipeline->topology_at_rasterizer = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP;
+                break;
         }
     }
 
@@ -1434,7 +1448,7 @@ static void process_execution_modes(shader_module const *src, spirv_inst_iter en
 
 static bool validate_pipeline_shader_stage(layer_data *dev_data, VkPipelineShaderStageCreateInfo const *pStage,
                                            PIPELINE_STATE *pipeline, shader_module const **out_module,
-                                           spirv_inst_iter *out_entrypoint) {
+                                           shader_entrypoint const **out_entrypoint) {
     bool skip = false;
     auto module = *out_module = GetShaderModuleState(dev_data, pStage->module);
     auto report_data = GetReportData(dev_data);
@@ -1443,31 +1457,25 @@ static bool validate_pipeline_shader_stage(layer_data *dev_data, VkPipelineShade
 
     // Find the entrypoint
     auto entrypoint = *out_entrypoint = find_entrypoint(module, pStage->pName, pStage->stage);
-    if (entrypoint == module->end()) {
-        if (log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                    "VUID-VkPipelineShaderStageCreateInfo-pName-00707", "No entrypoint found named `%s` for stage %s..",
-                    pStage->pName, string_VkShaderStageFlagBits(pStage->stage))) {
-            return true;  // no point continuing beyond here, any analysis is just going to be garbage.
-        }
+    if (!entrypoint) {
+        // No point continuing beyond here, any analysis is just going to be garbage.
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       "VUID-VkPipelineShaderStageCreateInfo-pName-00707", "No entrypoint found named `%s` for stage %s..",
+                       pStage->pName, string_VkShaderStageFlagBits(pStage->stage));
     }
 
-    // Mark accessible ids
-    auto accessible_ids = mark_accessible_ids(module, entrypoint);
-    process_execution_modes(module, entrypoint, pipeline);
-
-    // Validate descriptor set layout against what the entrypoint actually uses
-    bool has_writable_descriptor = false;
-    auto descriptor_uses = collect_interface_by_descriptor_slot(report_data, module, accessible_ids, &has_writable_descriptor);
+    // Accessible ids, descriptor uses and interfaces were reflected when the module was created
+    process_execution_modes(entrypoint, pipeline);
 
     // Validate shader capabilities against enabled device features
-    skip |= validate_shader_capabilities(dev_data, module, pStage->stage, has_writable_descriptor);
+    skip |= validate_shader_capabilities(dev_data, module, pStage->stage, entrypoint->has_writable_descriptor);
 
     skip |= validate_specialization_offsets(report_data, pStage);
-    skip |= validate_push_constant_usage(report_data, pipeline->pipeline_layout.push_constant_ranges.get(), module, accessible_ids,
-                                         pStage->stage);
+    skip |= validate_push_constant_usage(report_data, pipeline->pipeline_layout.push_constant_ranges.get(), module,
+                                         entrypoint->accessible_ids, pStage->stage);
 
-    // Validate descriptor use
-    for (auto use : descriptor_uses) {
+    // Validate descriptor set layout against what the entrypoint actually uses
+    for (auto const &use : entrypoint->descriptor_uses) {
         // While validating shaders capture which slots are used by the pipeline
         auto &reqs = pipeline->active_slots[use.first.first][use.first.second];
         reqs = descriptor_req(reqs | descriptor_type_to_reqs(module, use.second.type_id));
@@ -1504,12 +1512,10 @@ static bool validate_pipeline_shader_stage(layer_data *dev_data, VkPipelineShade
 
     // Validate use of input attachments against subpass structure
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto input_attachment_uses = collect_interface_by_input_attachment_index(module, accessible_ids);
-
         auto rpci = pipeline->rp_state->createInfo.ptr();
         auto subpass = pipeline->graphicsPipelineCI.subpass;
 
-        for (auto use : input_attachment_uses) {
+        for (auto const &use : entrypoint->input_attachment_uses) {
             auto input_attachments = rpci->pSubpasses[subpass].pInputAttachments;
             auto index = (input_attachments && use.first < rpci->pSubpasses[subpass].inputAttachmentCount)
                              ? input_attachments[use.first].attachment
@@ -1533,15 +1539,14 @@ static bool validate_pipeline_shader_stage(layer_data *dev_data, VkPipelineShade
 }
 
 static bool validate_interface_between_stages(debug_report_data const *report_data, shader_module const *producer,
-                                              spirv_inst_iter producer_entrypoint, shader_stage_attributes const *producer_stage,
-                                              shader_module const *consumer, spirv_inst_iter consumer_entrypoint,
+                                              shader_entrypoint const *producer_entrypoint,
+                                              shader_stage_attributes const *producer_stage, shader_module const *consumer,
+                                              shader_entrypoint const *consumer_entrypoint,
                                               shader_stage_attributes const *consumer_stage) {
     bool skip = false;
 
-    auto outputs =
-        collect_interface_by_location(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
-    auto inputs =
-        collect_interface_by_location(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
+    auto const &outputs = producer_entrypoint->outputs;
+    auto const &inputs = consumer_entrypoint->inputs;
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -1610,8 +1615,7 @@ bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIPELINE_S
 
     shader_module const *shaders[5];
     memset(shaders, 0, sizeof(shaders));
-    spirv_inst_iter entrypoints[5];
-    memset(entrypoints, 0, sizeof(entrypoints));
+    shader_entrypoint const *entrypoints[5] = {};
     bool skip = false;
 
     for (uint32_t i = 0; i < pCreateInfo->stageCount; i++) {
@@ -1629,7 +1633,7 @@ bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIPELINE_S
         skip |= validate_vi_consistency(report_data, vi);
     }
 
-    if (shaders[vertex_stage] && shaders[vertex_stage]->has_valid_spirv) {
+    if (entrypoints[vertex_stage]) {
         skip |= validate_vi_against_vs_inputs(report_data, vi, shaders[vertex_stage], entrypoints[vertex_stage]);
     }
 
@@ -1644,7 +1648,7 @@ bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIPELINE_S
     for (; producer != fragment_stage && consumer <= fragment_stage; consumer++) {
         assert(shaders[producer]);
         if (shaders[consumer]) {
-            if (shaders[consumer]->has_valid_spirv && shaders[producer]->has_valid_spirv) {
+            if (entrypoints[consumer] && entrypoints[producer]) {
                 skip |= validate_interface_between_stages(report_data, shaders[producer], entrypoints[producer],
                                                           &shader_stage_attribs[producer], shaders[consumer], entrypoints[consumer],
                                                           &shader_stage_attribs[consumer]);
@@ -1654,7 +1658,7 @@ bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIPELINE_S
         }
     }
 
-    if (shaders[fragment_stage] && shaders[fragment_stage]->has_valid_spirv) {
+    if (entrypoints[fragment_stage]) {
         skip |= validate_fs_outputs_against_render_pass(report_data, shaders[fragment_stage], entrypoints[fragment_stage], pipeline,
                                                         pCreateInfo->subpass);
     }
@@ -1666,13 +1670,258 @@ bool validate_compute_pipeline(layer_data *dev_data, PIPELINE_STATE *pipeline) {
     auto pCreateInfo = pipeline->computePipelineCI.ptr();
 
     shader_module const *module;
-    spirv_inst_iter entrypoint;
+    shader_entrypoint const *entrypoint;
 
     return validate_pipeline_shader_stage(dev_data, &pCreateInfo->stage, pipeline, &module, &entrypoint);
 }
 
 uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
 
+namespace {
+// Flattens the inputs of graphics pipeline validation into a byte string for hashing. Structs are added member by member, or
+// as raw bytes only when they have no padding, so stale padding never makes equal pipelines hash differently.
+class PipelineKeyWriter {
+   public:
+    template <typename T>
+    void Add(T value) {
+        AddBytes(&value, sizeof(value));
+    }
+
+    void AddBytes(void const *data, size_t size) {
+        auto bytes = static_cast<uint8_t const *>(data);
+        key_.insert(key_.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void AddArray(T const *items, uint32_t count) {
+        Add(items ? count : 0u);
+        if (items) AddBytes(items, sizeof(T) * count);
+    }
+
+    void AddString(char const *str) {
+        size_t length = str ? strlen(str) : 0;
+        Add(length);
+        AddBytes(str, length);
+    }
+
+    uint64_t Hash() const {
+        uint64_t hash = XXH64(key_.data(), key_.size(), 0);
+        return hash ? hash : 1;  // 0 means "not cacheable"
+    }
+
+   private:
+    std::vector<uint8_t> key_;
+};
+}  // namespace
+
+uint64_t ValidationCache::MakePipelineHash(layer_data *dev_data, PIPELINE_STATE const *pipeline, ValidationCache **cache) {
+    auto const &ci = pipeline->graphicsPipelineCI;
+    *cache = nullptr;
+    if (ci.pNext || !ci.stageCount) return 0;
+
+    PipelineKeyWriter key;
+
+    // Device: results depend on enabled features and extensions, and vertex format support of the physical device
+    auto props = GetPhysicalDeviceProperties(dev_data);
+    key.Add(props->vendorID);
+    key.Add(props->deviceID);
+    key.Add(props->driverVersion);
+    key.AddBytes(props->pipelineCacheUUID, VK_UUID_SIZE);
+    key.Add(GetApiVersion(dev_data));
+    key.AddBytes(GetEnabledFeatures(dev_data), sizeof(VkPhysicalDeviceFeatures));
+    auto indexing = GetEnabledDescriptorIndexingFeatures(dev_data);
+    auto indexing_bools = offsetof(VkPhysicalDeviceDescriptorIndexingFeaturesEXT, shaderInputAttachmentArrayDynamicIndexing);
+    key.AddBytes(reinterpret_cast<uint8_t const *>(indexing) + indexing_bools, sizeof(*indexing) - indexing_bools);
+    key.AddBytes(GetDeviceExtensions(dev_data), sizeof(DeviceExtensions));
+
+    // Shader stages. Every module must name the same validation cache.
+    key.Add(ci.flags);
+    key.Add(ci.stageCount);
+    for (uint32_t i = 0; i < ci.stageCount; i++) {
+        auto const &stage = ci.pStages[i];
+        auto module = GetShaderModuleState(dev_data, stage.module);
+        if (stage.pNext || !module || !module->validation_cache) return 0;
+        if (*cache && VkValidationCacheEXT(*cache) != module->validation_cache) return 0;
+        *cache = (ValidationCache *)module->validation_cache;
+
+        key.Add(stage.flags);
+        key.Add(stage.stage);
+        key.Add(module->has_valid_spirv);
+        key.Add(module->spirv_hash);
+        key.AddString(stage.pName);
+        auto spec = stage.pSpecializationInfo;
+        key.Add(spec != nullptr);
+        if (spec) {
+            key.AddArray(spec->pMapEntries, spec->mapEntryCount);
+            key.Add(spec->dataSize);
+            if (spec->pData) key.AddBytes(spec->pData, spec->dataSize);
+        }
+    }
+
+    // Fixed function state
+    if (auto vi = ci.pVertexInputState) {
+        if (vi->pNext) return 0;
+        key.Add(vi->flags);
+        key.AddArray(vi->pVertexBindingDescriptions, vi->vertexBindingDescriptionCount);
+        key.AddArray(vi->pVertexAttributeDescriptions, vi->vertexAttributeDescriptionCount);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto ia = ci.pInputAssemblyState) {
+        if (ia->pNext) return 0;
+        key.Add(ia->flags);
+        key.Add(ia->topology);
+        key.Add(ia->primitiveRestartEnable);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto ts = ci.pTessellationState) {
+        if (ts->pNext) return 0;
+        key.Add(ts->flags);
+        key.Add(ts->patchControlPoints);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto vp = ci.pViewportState) {
+        if (vp->pNext) return 0;
+        key.Add(vp->flags);
+        key.Add(vp->viewportCount);
+        key.AddArray(vp->pViewports, vp->viewportCount);
+        key.Add(vp->scissorCount);
+        key.AddArray(vp->pScissors, vp->scissorCount);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto rs = ci.pRasterizationState) {
+        if (rs->pNext) return 0;
+        key.Add(rs->flags);
+        key.Add(rs->depthClampEnable);
+        key.Add(rs->rasterizerDiscardEnable);
+        key.Add(rs->polygonMode);
+        key.Add(rs->cullMode);
+        key.Add(rs->frontFace);
+        key.Add(rs->depthBiasEnable);
+        key.Add(rs->depthBiasConstantFactor);
+        key.Add(rs->depthBiasClamp);
+        key.Add(rs->depthBiasSlopeFactor);
+        key.Add(rs->lineWidth);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto ms = ci.pMultisampleState) {
+        if (ms->pNext) return 0;
+        key.Add(ms->flags);
+        key.Add(ms->rasterizationSamples);
+        key.Add(ms->sampleShadingEnable);
+        key.Add(ms->minSampleShading);
+        key.AddArray(ms->pSampleMask, (ms->rasterizationSamples + 31) / 32);
+        key.Add(ms->alphaToCoverageEnable);
+        key.Add(ms->alphaToOneEnable);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto ds = ci.pDepthStencilState) {
+        if (ds->pNext) return 0;
+        key.Add(ds->flags);
+        key.Add(ds->depthTestEnable);
+        key.Add(ds->depthWriteEnable);
+        key.Add(ds->depthCompareOp);
+        key.Add(ds->depthBoundsTestEnable);
+        key.Add(ds->stencilTestEnable);
+        key.Add(ds->front);
+        key.Add(ds->back);
+        key.Add(ds->minDepthBounds);
+        key.Add(ds->maxDepthBounds);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto cb = ci.pColorBlendState) {
+        if (cb->pNext) return 0;
+        key.Add(cb->flags);
+        key.Add(cb->logicOpEnable);
+        key.Add(cb->logicOp);
+        key.AddArray(cb->pAttachments, cb->attachmentCount);
+        key.AddBytes(cb->blendConstants, sizeof(cb->blendConstants));
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+    if (auto dyn = ci.pDynamicState) {
+        if (dyn->pNext) return 0;
+        key.Add(dyn->flags);
+        key.AddArray(dyn->pDynamicStates, dyn->dynamicStateCount);
+    } else {
+        key.Add(uint32_t(~0u));
+    }
+
+    // Pipeline layout, as far as shader validation looks at it
+    auto const &layout = pipeline->pipeline_layout;
+    key.Add(static_cast<uint32_t>(layout.set_layouts.size()));
+    for (auto const &set_layout : layout.set_layouts) {
+        key.Add(set_layout->GetCreateFlags());
+        key.Add(set_layout->GetBindingCount());
+        for (uint32_t i = 0; i < set_layout->GetBindingCount(); i++) {
+            auto binding = set_layout->GetDescriptorSetLayoutBindingPtrFromIndex(i);
+            key.Add(binding->binding);
+            key.Add(binding->descriptorType);
+            key.Add(binding->descriptorCount);
+            key.Add(binding->stageFlags);
+            key.Add(set_layout->GetDescriptorBindingFlagsFromIndex(i));
+        }
+    }
+    if (layout.push_constant_ranges) {
+        auto const &push_constants = *layout.push_constant_ranges;
+        key.AddArray(push_constants.data(), static_cast<uint32_t>(push_constants.size()));
+    } else {
+        key.Add(0u);
+    }
+
+    // Render pass attachments and the targeted subpass
+    auto const &rpci = pipeline->rp_state->createInfo;
+    if (rpci.pNext) return 0;
+    key.AddArray(rpci.pAttachments, rpci.attachmentCount);
+    key.Add(rpci.subpassCount);
+    key.Add(ci.subpass);
+    if (ci.subpass < rpci.subpassCount) {
+        auto const &subpass = rpci.pSubpasses[ci.subpass];
+        key.Add(subpass.flags);
+        key.Add(subpass.pipelineBindPoint);
+        key.AddArray(subpass.pInputAttachments, subpass.inputAttachmentCount);
+        key.AddArray(subpass.pColorAttachments, subpass.colorAttachmentCount);
+        key.AddArray(subpass.pResolveAttachments, subpass.colorAttachmentCount);
+        key.AddArray(subpass.pDepthStencilAttachment, 1);
+    }
+
+    return key.Hash();
+}
+
+bool ValidationCache::RestorePipeline(uint64_t hash, PIPELINE_STATE *pipeline) const {
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = good_pipelines.find(hash);
+    if (it == good_pipelines.end()) return false;
+
+    pipeline->topology_at_rasterizer = static_cast<VkPrimitiveTopology>(it->second.topology_at_rasterizer);
+    auto const &slots = it->second.active_slots;
+    for (size_t i = 0; i + 2 < slots.size(); i += 3) {
+        pipeline->active_slots[slots[i]][slots[i + 1]] = static_cast<descriptor_req>(slots[i + 2]);
+    }
+    return true;
+}
+
+void ValidationCache::InsertPipeline(uint64_t hash, PIPELINE_STATE const *pipeline) {
+    PipelineCaptures captures;
+    captures.topology_at_rasterizer = static_cast<uint32_t>(pipeline->topology_at_rasterizer);
+    for (auto const &set : pipeline->active_slots) {
+        for (auto const &binding : set.second) {
+            captures.active_slots.push_back(set.first);
+            captures.active_slots.push_back(binding.first);
+            captures.active_slots.push_back(static_cast<uint32_t>(binding.second));
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+    good_pipelines[hash] = std::move(captures);
+}
+
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     while ((pCreateInfo = (VkShaderModuleCreateInfo const *)pCreateInfo->pNext) != nullptr) {
         if (pCreateInfo->sType == VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT)
@@ -1682,6 +1931,13 @@ static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *p
     return nullptr;
 }
 
+void RecordShaderModuleValidationCache(shader_module *module, VkShaderModuleCreateInfo const *pCreateInfo) {
+    auto cache = GetValidationCacheInfo(pCreateInfo);
+    if (!cache) return;
+    module->validation_cache = VkValidationCacheEXT(cache);
+    module->spirv_hash = XXH64(pCreateInfo->pCode, pCreateInfo->codeSize, 0);
+}
+
 bool PreCallValidateCreateShaderModule(layer_data *dev_data, VkShaderModuleCreateInfo const *pCreateInfo, bool *spirv_valid) {
     bool skip = false;
     spv_result_t spv_valid = SPV_SUCCESS;
@@ -20,6 +20,10 @@
 #ifndef VULKAN_SHADER_VALIDATION_H
 #define VULKAN_SHADER_VALIDATION_H
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
 #include <spirv_tools_commit_id.h>
 
 // A forward iterator over spirv instructions. Provides easy access to len, opcode, and content words
@@ -67,24 +71,90 @@ struct spirv_inst_iter {
     spirv_inst_iter const &operator*() const { return *this; }
 };
 
+typedef std::pair<unsigned, unsigned> location_t;
+typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+
+struct interface_var {
+    uint32_t id;
+    uint32_t type_id;
+    uint32_t offset;
+    bool is_patch;
+    bool is_block_member;
+    bool is_relaxed_precision;
+    // TODO: collect the name, too? Isn't required to be present.
+};
+
+// The decorations validation looks at, for an id or a struct member
+struct decoration_set {
+    enum {
+        location_bit = 1 << 0,
+        patch_bit = 1 << 1,
+        block_bit = 1 << 2,
+        buffer_block_bit = 1 << 3,
+        nonwritable_bit = 1 << 4,
+        relaxed_precision_bit = 1 << 5,
+        builtin_bit = 1 << 6,
+        input_attachment_index_bit = 1 << 7,
+        offset_bit = 1 << 8,
+    };
+    uint32_t flags = 0;
+    uint32_t location = 0;
+    uint32_t component = 0;
+    uint32_t input_attachment_index = 0;
+    uint32_t descriptor_set = 0;
+    uint32_t binding = 0;
+    uint32_t offset = 0;
+};
+
+// Everything pipeline validation needs about one OpEntryPoint, so pipelines don't have to rescan the module
+struct shader_entrypoint {
+    std::string name;
+    VkShaderStageFlagBits stage;
+    uint32_t id;
+    std::vector<uint32_t> execution_modes;
+    // Ids referenced by the entrypoint's static call tree, sorted
+    std::vector<uint32_t> accessible_ids;
+    std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+    bool has_writable_descriptor;
+    std::vector<std::pair<uint32_t, interface_var>> input_attachment_uses;
+    // Location-based interface, graphics stages only
+    std::map<location_t, interface_var> inputs;
+    std::map<location_t, interface_var> outputs;
+};
+
 struct shader_module {
     // The spirv image itself
     std::vector<uint32_t> words;
     // A mapping of <id> to the first word of its def. this is useful because walking type
     // trees, constant expressions, etc requires jumping all over the instruction stream.
-    std::unordered_map<unsigned, unsigned> def_index;
+    // Ids are dense below the header's id bound, so this is indexed directly by id; 0 (inside the header) means no def.
+    std::vector<uint32_t> def_index;
+    // Used instead of def_index when the id bound is too large for the module to plausibly use (see build_def_index)
+    std::unordered_map<uint32_t, uint32_t> sparse_def_index;
+    // Reflection, built once at creation by build_reflection()
+    std::unordered_map<unsigned, decoration_set> decorations;
+    std::unordered_map<unsigned, std::map<unsigned, decoration_set>> member_decorations;
+    std::vector<uint32_t> capabilities;
+    std::vector<shader_entrypoint> entrypoints;
     bool has_valid_spirv;
     VkShaderModule vk_shader_module;
+    // Validation cache named at creation, if any. Pipelines built only from modules sharing a cache record their results there.
+    VkValidationCacheEXT validation_cache;
+    // Identifies the SPIR-V in pipeline validation cache keys
+    uint64_t spirv_hash;
 
     shader_module(VkShaderModuleCreateInfo const *pCreateInfo, VkShaderModule shaderModule)
         : words((uint32_t *)pCreateInfo->pCode, (uint32_t *)pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t)),
           def_index(),
           has_valid_spirv(true),
-          vk_shader_module(shaderModule) {
+          vk_shader_module(shaderModule),
+          validation_cache(VK_NULL_HANDLE),
+          spirv_hash(0) {
         build_def_index();
+        build_reflection();
     }
 
-    shader_module() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE) {}
+    shader_module() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE), validation_cache(VK_NULL_HANDLE), spirv_hash(0) {}
 
     // Expose begin() / end() to enable range-based for
     spirv_inst_iter begin() const { return spirv_inst_iter(words.begin(), words.begin() + 5); }  // First insn
@@ -94,14 +164,24 @@ struct shader_module {
 
     // Gets an iterator to the definition of an id
     spirv_inst_iter get_def(unsigned id) const {
-        auto it = def_index.find(id);
-        if (it == def_index.end()) {
-            return end();
+        uint32_t offset = 0;
+        if (id < def_index.size()) {
+            offset = def_index[id];
+        } else if (!sparse_def_index.empty()) {
+            auto it = sparse_def_index.find(id);
+            if (it != sparse_def_index.end()) offset = it->second;
         }
-        return at(it->second);
+        return offset ? at(offset) : end();
+    }
+
+    decoration_set const &get_decorations(unsigned id) const {
+        static const decoration_set none;
+        auto it = decorations.find(id);
+        return it == decorations.end() ? none : it->second;
     }
 
     void build_def_index();
+    void build_reflection();
 };
 
 class ValidationCache {
@@ -110,6 +190,19 @@ class ValidationCache {
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     std::unordered_set<uint32_t> good_shader_hashes;
+
+    // Graphics pipelines whose create-info graph (see MakePipelineHash) passed validation before, with the state that validation
+    // captures into PIPELINE_STATE, so a hit can skip shader/interface validation entirely.
+    struct PipelineCaptures {
+        uint32_t topology_at_rasterizer;
+        // (set, binding, descriptor_req) triples of PIPELINE_STATE::active_slots
+        std::vector<uint32_t> active_slots;
+    };
+    std::unordered_map<uint64_t, PipelineCaptures> good_pipelines;
+
+    // Shader module and pipeline creation may run concurrently against the same cache
+    mutable std::mutex lock;
+
     ValidationCache() {}
 
    public:
@@ -119,6 +212,8 @@ class ValidationCache {
         return VkValidationCacheEXT(cache);
     }
 
+    // Layout after the header: shader hash count, shader hashes, pipeline count, then per pipeline its 64-bit hash (low word
+    // first), topology, active slot count and the active slot triples. All fields are uint32_t.
     void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
         auto size = headerSize;
@@ -128,20 +223,54 @@ class ValidationCache {
         if (data[0] != size) return;
         if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
         uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
+        CacheUuid(expected_uuid);
         if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
 
         data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+        uint32_t const *const data_end = data + (pCreateInfo->initialDataSize - headerSize) / sizeof(uint32_t);
 
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
+        std::lock_guard<std::mutex> guard(lock);
+        // A truncated blob (see Write) simply yields fewer entries
+        if (data == data_end) return;
+        uint32_t shader_count = *data++;
+        for (; shader_count && data < data_end; shader_count--, data++) {
             good_shader_hashes.insert(*data);
         }
+        if (shader_count || data == data_end) return;
+        uint32_t pipeline_count = *data++;
+        for (; pipeline_count && (data_end - data) >= 4; pipeline_count--) {
+            const uint64_t hash = uint64_t(data[0]) | (uint64_t(data[1]) << 32);
+            PipelineCaptures captures;
+            captures.topology_at_rasterizer = data[2];
+            const uint32_t slot_words = data[3] * 3;
+            data += 4;
+            if (uint32_t(data_end - data) < slot_words) return;
+            captures.active_slots.assign(data, data + slot_words);
+            data += slot_words;
+            good_pipelines[hash] = std::move(captures);
+        }
     }
 
     void Write(size_t *pDataSize, void *pData) {
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+        std::vector<uint32_t> body;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            body.reserve(2 + good_shader_hashes.size() + 4 * good_pipelines.size());
+            body.push_back(static_cast<uint32_t>(good_shader_hashes.size()));
+            body.insert(body.end(), good_shader_hashes.begin(), good_shader_hashes.end());
+            body.push_back(static_cast<uint32_t>(good_pipelines.size()));
+            for (const auto &pipeline : good_pipelines) {
+                body.push_back(static_cast<uint32_t>(pipeline.first));
+                body.push_back(static_cast<uint32_t>(pipeline.first >> 32));
+                body.push_back(pipeline.second.topology_at_rasterizer);
+                body.push_back(static_cast<uint32_t>(pipeline.second.active_slots.size() / 3));
+                body.insert(body.end(), pipeline.second.active_slots.begin(), pipeline.second.active_slots.end());
+            }
+        }
+
         if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes.size() * sizeof(uint32_t);
+            *pDataSize = headerSize + body.size() * sizeof(uint32_t);
             return;
         }
 
@@ -151,34 +280,58 @@ class ValidationCache {
         }
 
         uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
 
         // Write the header
         *out++ = headerSize;
         *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
+        CacheUuid(reinterpret_cast<uint8_t *>(out));
         out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
 
-        for (auto it = good_shader_hashes.begin(); it != good_shader_hashes.end() && actualSize < *pDataSize;
-             it++, out++, actualSize += sizeof(uint32_t)) {
-            *out = *it;
-        }
+        const size_t body_words = std::min(body.size(), (*pDataSize - headerSize) / sizeof(uint32_t));
+        std::copy(body.begin(), body.begin() + body_words, out);
 
-        *pDataSize = actualSize;
+        *pDataSize = headerSize + body_words * sizeof(uint32_t);
     }
 
     void Merge(ValidationCache const *other) {
+        std::unique_lock<std::mutex> guard(lock, std::defer_lock);
+        std::unique_lock<std::mutex> other_guard(other->lock, std::defer_lock);
+        std::lock(guard, other_guard);
         good_shader_hashes.reserve(good_shader_hashes.size() + other->good_shader_hashes.size());
         for (auto h : other->good_shader_hashes) good_shader_hashes.insert(h);
+        for (const auto &pipeline : other->good_pipelines) good_pipelines.insert(pipeline);
     }
 
     static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
 
-    bool Contains(uint32_t hash) { return good_shader_hashes.count(hash) != 0; }
+    bool Contains(uint32_t hash) {
+        std::lock_guard<std::mutex> guard(lock);
+        return good_shader_hashes.count(hash) != 0;
+    }
+
+    void Insert(uint32_t hash) {
+        std::lock_guard<std::mutex> guard(lock);
+        good_shader_hashes.insert(hash);
+    }
+
+    // Hash of everything graphics pipeline validation depends on, or 0 if the pipeline can't be cached (no common cache among its
+    // shader modules, or extension structs the hash doesn't cover). Looks up shader modules, so call with the global lock held.
+    static uint64_t MakePipelineHash(layer_data *dev_data, PIPELINE_STATE const *pipeline, ValidationCache **cache);
 
-    void Insert(uint32_t hash) { good_shader_hashes.insert(hash); }
+    // On a hit, restores the state validation would have captured into pipeline and returns true
+    bool RestorePipeline(uint64_t hash, PIPELINE_STATE *pipeline) const;
+    void InsertPipeline(uint64_t hash, PIPELINE_STATE const *pipeline);
 
    private:
+    // Format 2 added pipeline entries. Mixing the format into the UUID makes older layers discard newer blobs (and vice versa)
+    // instead of misreading them.
+    static const uint8_t kCacheFormatVersion = 2;
+
+    void CacheUuid(uint8_t uuid[VK_UUID_SIZE]) {
+        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, uuid);
+        uuid[VK_UUID_SIZE - 1] ^= kCacheFormatVersion;
+    }
+
     void Sha1ToVkUuid(const char *sha1_str, uint8_t uuid[VK_UUID_SIZE]) {
         // Convert sha1_str from a hex string to binary. We only need VK_UUID_BYTES of
         // output, so pad with zeroes if the input string is shorter than that, and truncate
@@ -196,7 +349,7 @@ class ValidationCache {
 
 bool validate_and_capture_pipeline_shader_state(layer_data *dev_data, PIPELINE_STATE *pPipeline);
 bool validate_compute_pipeline(layer_data *dev_data, PIPELINE_STATE *pPipeline);
-typedef std::pair<unsigned, unsigned> descriptor_slot_t;
 bool PreCallValidateCreateShaderModule(layer_data *dev_data, VkShaderModuleCreateInfo const *pCreateInfo, bool *spirv_valid);
+void RecordShaderModuleValidationCache(shader_module *module, VkShaderModuleCreateInfo const *pCreateInfo);
 
 #endif  // VULKAN_SHADER_VALIDATION_H
@@ -0,0 +1,222 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef SLAB_ALLOCATOR_H_
+#define SLAB_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <functional>
+#include <new>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Fixed-size object allocator for state objects with a natural owner (e.g. descriptor sets and their pool).
+//
+// Storage is carved from chunks of chunk_capacity slots, and freed slots go on a free list for the next New(), so an
+// owner that repeatedly frees and reallocates (vkResetDescriptorPool every frame) stops touching the heap once it
+// reaches its working set. Chunks are only returned when the allocator itself is destroyed, by which time every object
+// must have been deleted.
+//
+// T only needs to be complete where New() and Delete() are instantiated, so the allocator can be a member of a struct
+// that merely forward-declares T.
+template <typename T>
+class SlabAllocator {
+   public:
+    struct Stats {
+        uint64_t allocations;  // Calls to New()
+        uint64_t reused;       // ... of which were served from the free list
+        uint64_t chunks;       // Chunks allocated from the heap
+        uint64_t live;         // Objects currently allocated
+        uint64_t peak_live;    // High-water mark of live
+    };
+
+    explicit SlabAllocator(size_t chunk_capacity = 64)
+        : chunk_capacity_(std::max<size_t>(chunk_capacity, 1)), next_unused_(0), free_list_(nullptr), stats_() {}
+    ~SlabAllocator() { assert(stats_.live == 0); }
+    SlabAllocator(const SlabAllocator &) = delete;
+    SlabAllocator &operator=(const SlabAllocator &) = delete;
+
+    template <typename... Args>
+    T *New(Args &&... args) {
+        T *object = new (Acquire()) T(std::forward<Args>(args)...);
+        stats_.allocations++;
+        stats_.live++;
+        stats_.peak_live = std::max(stats_.peak_live, stats_.live);
+        return object;
+    }
+
+    void Delete(T *object) {
+        if (!object) return;
+        object->~T();
+        Release(object);
+        stats_.live--;
+    }
+
+    const Stats &GetStats() const { return stats_; }
+
+   private:
+    static size_t SlotSize() {
+        size_t size = std::max(sizeof(T), sizeof(void *));
+        return (size + alignof(T) - 1) / alignof(T) * alignof(T);
+    }
+
+    void *Acquire() {
+        if (free_list_) {
+            void *slot = free_list_;
+            free_list_ = *static_cast<void **>(slot);
+            stats_.reused++;
+            return slot;
+        }
+        if (chunks_.empty() || next_unused_ == chunk_capacity_) {
+            // operator new[] storage is suitably aligned for any type without extended alignment
+            static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+            chunks_.emplace_back(new char[SlotSize() * chunk_capacity_]);
+            next_unused_ = 0;
+            stats_.chunks++;
+        }
+        return chunks_.back().get() + SlotSize() * next_unused_++;
+    }
+
+    void Release(void *slot) {
+        *static_cast<void **>(slot) = free_list_;
+        free_list_ = slot;
+    }
+
+    size_t chunk_capacity_;
+    size_t next_unused_;  // First never-used slot in the newest chunk
+    void *free_list_;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    Stats stats_;
+};
+
+// Size-classed counterpart of SlabAllocator for the nodes of standard containers, shared by all the containers of one owner
+// (e.g. the sets and maps of a command buffer). Blocks given back are kept on a free list per size class rather than freed,
+// so containers that are cleared and refilled (vkResetCommandBuffer / vkBeginCommandBuffer every frame) run on the memory
+// they used last time. Requests larger than kMaxBlockSize go straight to the heap.
+//
+// Chunks are only returned when the recycler itself is destroyed, so it must outlive every container using it. There is no
+// internal locking: whatever serializes access to the owner's containers covers the recycler too.
+class NodeRecycler {
+   public:
+    static const size_t kGranularity = alignof(std::max_align_t);
+    static const size_t kMaxBlockSize = 256;
+
+    explicit NodeRecycler(size_t chunk_size = 4096)
+        : chunk_size_(chunk_size > kMaxBlockSize ? chunk_size : kMaxBlockSize), chunk_used_(0) {
+        std::fill(free_lists_, free_lists_ + kClassCount, nullptr);
+    }
+    NodeRecycler(const NodeRecycler &) = delete;
+    NodeRecycler &operator=(const NodeRecycler &) = delete;
+
+    void *Allocate(size_t size) {
+        if (size > kMaxBlockSize) return ::operator new(size);
+        const size_t size_class = SizeClass(size);
+        void *&free_list = free_lists_[size_class];
+        if (free_list) {
+            void *block = free_list;
+            free_list = *static_cast<void **>(block);
+            return block;
+        }
+        const size_t block_size = (size_class + 1) * kGranularity;
+        if (chunks_.empty() || chunk_used_ + block_size > chunk_size_) {
+            // Whatever is left of the previous chunk is abandoned; it is less than one block of the largest class
+            chunks_.emplace_back(new char[chunk_size_]);
+            chunk_used_ = 0;
+        }
+        void *block = chunks_.back().get() + chunk_used_;
+        chunk_used_ += block_size;
+        return block;
+    }
+
+    void Deallocate(void *block, size_t size) {
+        if (size > kMaxBlockSize) {
+            ::operator delete(block);
+            return;
+        }
+        void *&free_list = free_lists_[SizeClass(size)];
+        *static_cast<void **>(block) = free_list;
+        free_list = block;
+    }
+
+   private:
+    static const size_t kClassCount = kMaxBlockSize / kGranularity;
+    static size_t SizeClass(size_t size) { return size ? (size - 1) / kGranularity : 0; }
+
+    size_t chunk_size_;
+    size_t chunk_used_;  // Bytes handed out from the newest chunk
+    void *free_lists_[kClassCount];
+    std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
+// Standard allocator drawing from a NodeRecycler, for containers owned by the recycler's owner. A default-constructed
+// allocator has no recycler and uses the heap; copies of a container get one of those, so a copy never outlives the
+// recycler its original was tied to.
+template <typename T>
+class RecyclingAllocator {
+   public:
+    typedef T value_type;
+    template <typename U>
+    struct rebind {
+        typedef RecyclingAllocator<U> other;
+    };
+
+    RecyclingAllocator() : recycler_(nullptr) {}
+    RecyclingAllocator(NodeRecycler *recycler) : recycler_(recycler) {}
+    template <typename U>
+    RecyclingAllocator(const RecyclingAllocator<U> &other) : recycler_(other.recycler()) {}
+
+    T *allocate(size_t count) {
+        static_assert(alignof(T) <= NodeRecycler::kGranularity, "over-aligned types are not supported");
+        const size_t size = count * sizeof(T);
+        return static_cast<T *>(recycler_ ? recycler_->Allocate(size) : ::operator new(size));
+    }
+    void deallocate(T *pointer, size_t count) {
+        if (recycler_) {
+            recycler_->Deallocate(pointer, count * sizeof(T));
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+    RecyclingAllocator select_on_container_copy_construction() const { return RecyclingAllocator(); }
+
+    NodeRecycler *recycler() const { return recycler_; }
+
+   private:
+    NodeRecycler *recycler_;
+};
+
+template <typename T, typename U>
+bool operator==(const RecyclingAllocator<T> &lhs, const RecyclingAllocator<U> &rhs) {
+    return lhs.recycler() == rhs.recycler();
+}
+template <typename T, typename U>
+bool operator!=(const RecyclingAllocator<T> &lhs, const RecyclingAllocator<U> &rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T, typename Hash = std::hash<T>>
+using RecyclingUnorderedSet = std::unordered_set<T, Hash, std::equal_to<T>, RecyclingAllocator<T>>;
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+using RecyclingUnorderedMap = std::unordered_map<Key, T, Hash, std::equal_to<Key>, RecyclingAllocator<std::pair<const Key, T>>>;
+
+#endif  // SLAB_ALLOCATOR_H_
@@ -77,86 +77,48 @@ inline bool startMultiThread() {
 inline void finishMultiThread() { vulkan_in_use = false; }
 }  // namespace threading
 
+// Tracks the threads currently using each handle of one type. Handles are spread over independently locked shards, each an
+// open-addressed table that only allocates when it grows, so the uncontended path is a shard lock, a short probe and an
+// unlock. A thread that has to wait for an object waits on its shard's condition variable, which is only signalled when an
+// object in that shard goes out of use while someone is waiting.
 template <typename T>
 class counter {
    public:
     const char *typeName;
     VkDebugReportObjectTypeEXT objectType;
-    std::unordered_map<T, object_use_data> uses;
-    std::mutex counter_lock;
-    std::condition_variable counter_condition;
     void startWrite(debug_report_data *report_data, T object) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        Shard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        object_use_data *use_data = shard.Find(object);
+        if (!use_data) {
             // There is no current use of the object.  Record writer thread.
-            struct object_use_data *use_data = &uses[object];
-            use_data->reader_count = 0;
-            use_data->writer_count = 1;
-            use_data->thread = tid;
-        } else {
-            struct object_use_data *use_data = &uses[object];
-            if (use_data->reader_count == 0) {
-                // There are no readers.  Two writers just collided.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
-                                        THREADING_CHECKER_MULTIPLE_THREADS,
-                                        "THREADING ERROR : object of type %s is simultaneously used in "
-                                        "thread 0x%" PRIx64 " and thread 0x%" PRIx64,
-                                        typeName, (uint64_t)use_data->thread, (uint64_t)tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
-                        new_use_data->thread = tid;
-                        new_use_data->reader_count = 0;
-                        new_use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
+            shard.Insert(object, tid, 0, 1);
+        } else if (use_data->thread != tid) {
+            // This writer collided with readers or another writer.
+            skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
+                                THREADING_CHECKER_MULTIPLE_THREADS,
+                                "THREADING ERROR : object of type %s is simultaneously used in "
+                                "thread 0x%" PRIx64 " and thread 0x%" PRIx64,
+                                typeName, (uint64_t)use_data->thread, (uint64_t)tid);
+            if (skipCall) {
+                // Wait for thread-safe access to object instead of skipping call.
+                WaitUntilUnused(shard, lock, object);
+                // There is now no current use of the object.  Record writer thread.
+                shard.Insert(object, tid, 0, 1);
             } else {
-                // There are readers.  This writer collided with them.
-                if (use_data->thread != tid) {
-                    skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
-                                        THREADING_CHECKER_MULTIPLE_THREADS,
-                                        "THREADING ERROR : object of type %s is simultaneously used in "
-                                        "thread 0x%" PRIx64 " and thread 0x%" PRIx64,
-                                        typeName, (uint64_t)use_data->thread, (uint64_t)tid);
-                    if (skipCall) {
-                        // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.find(object) != uses.end()) {
-                            counter_condition.wait(lock);
-                        }
-                        // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
-                        new_use_data->thread = tid;
-                        new_use_data->reader_count = 0;
-                        new_use_data->writer_count = 1;
-                    } else {
-                        // Continue with an unsafe use of the object.
-                        use_data->thread = tid;
-                        use_data->writer_count += 1;
-                    }
-                } else {
-                    // This is either safe multiple use in one call, or recursive use.
-                    // There is no way to make recursion safe.  Just forge ahead.
-                    use_data->writer_count += 1;
-                }
+                // Continue with an unsafe use of the object.
+                use_data->thread = tid;
+                use_data->writer_count += 1;
             }
+        } else {
+            // This is either safe multiple use in one call, or recursive use.
+            // There is no way to make recursion safe.  Just forge ahead.
+            use_data->writer_count += 1;
         }
     }
 
@@ -165,14 +127,12 @@ class counter {
             return;
         }
         // Object is no longer in use
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].writer_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
+        Shard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        object_use_data *use_data = shard.Find(object);
+        if (!use_data) return;
+        use_data->writer_count -= 1;
+        Release(shard, lock, object, use_data);
     }
 
     void startRead(debug_report_data *report_data, T object) {
@@ -181,55 +141,151 @@ class counter {
         }
         bool skipCall = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (uses.find(object) == uses.end()) {
+        Shard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        object_use_data *use_data = shard.Find(object);
+        if (!use_data) {
             // There is no current use of the object.  Record reader count
-            struct object_use_data *use_data = &uses[object];
-            use_data->reader_count = 1;
-            use_data->writer_count = 0;
-            use_data->thread = tid;
-        } else if (uses[object].writer_count > 0 && uses[object].thread != tid) {
+            shard.Insert(object, tid, 1, 0);
+        } else if (use_data->writer_count > 0 && use_data->thread != tid) {
             // There is a writer of the object.
             skipCall |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object),
                                 THREADING_CHECKER_MULTIPLE_THREADS,
                                 "THREADING ERROR : object of type %s is simultaneously used in "
                                 "thread 0x%" PRIx64 " and thread 0x%" PRIx64,
-                                typeName, (uint64_t)uses[object].thread, (uint64_t)tid);
+                                typeName, (uint64_t)use_data->thread, (uint64_t)tid);
             if (skipCall) {
                 // Wait for thread-safe access to object instead of skipping call.
-                while (uses.find(object) != uses.end()) {
-                    counter_condition.wait(lock);
-                }
+                WaitUntilUnused(shard, lock, object);
                 // There is no current use of the object.  Record reader count
-                struct object_use_data *use_data = &uses[object];
-                use_data->reader_count = 1;
-                use_data->writer_count = 0;
-                use_data->thread = tid;
+                shard.Insert(object, tid, 1, 0);
             } else {
-                uses[object].reader_count += 1;
+                use_data->reader_count += 1;
             }
         } else {
             // There are other readers of the object.  Increase reader count
-            uses[object].reader_count += 1;
+            use_data->reader_count += 1;
         }
     }
     void finishRead(T object) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].reader_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
-        }
-        // Notify any waiting threads that this object may be safe to use
-        lock.unlock();
-        counter_condition.notify_all();
+        Shard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        object_use_data *use_data = shard.Find(object);
+        if (!use_data) return;
+        use_data->reader_count -= 1;
+        Release(shard, lock, object, use_data);
     }
     counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT) {
         typeName = name;
         objectType = type;
     }
+
+   private:
+    static const size_t kShardCount = 16;
+    static const size_t kShardBits = 4;
+    static const size_t kMinSlots = 8;
+
+    struct Slot {
+        T object;  // VK_NULL_HANDLE when empty
+        object_use_data use;
+    };
+
+    // Linear-probing table; erasure shifts later entries back instead of leaving tombstones. Cache-line aligned so threads on
+    // neighbouring shards don't contend for one line.
+    struct alignas(64) Shard {
+        Shard() : waiters(0), count(0) {}
+
+        object_use_data *Find(T object) {
+            if (slots.empty()) return nullptr;
+            size_t mask = slots.size() - 1;
+            for (size_t i = Home(object, mask);; i = (i + 1) & mask) {
+                if (slots[i].object == object) return &slots[i].use;
+                if (slots[i].object == VK_NULL_HANDLE) return nullptr;
+            }
+        }
+
+        void Insert(T object, loader_platform_thread_id thread, int reader_count, int writer_count) {
+            if ((count + 1) * 4 > slots.size() * 3) Grow();
+            size_t mask = slots.size() - 1;
+            size_t i = Home(object, mask);
+            while (slots[i].object != VK_NULL_HANDLE) i = (i + 1) & mask;
+            slots[i].object = object;
+            slots[i].use.thread = thread;
+            slots[i].use.reader_count = reader_count;
+            slots[i].use.writer_count = writer_count;
+            ++count;
+        }
+
+        void Erase(T object) {
+            size_t mask = slots.size() - 1;
+            size_t hole = Home(object, mask);
+            while (slots[hole].object != object) hole = (hole + 1) & mask;
+            for (size_t i = (hole + 1) & mask; slots[i].object != VK_NULL_HANDLE; i = (i + 1) & mask) {
+                // Move an entry back into the hole unless its home lies cyclically in (hole, i]
+                size_t home = Home(slots[i].object, mask);
+                if (((i - home) & mask) >= ((i - hole) & mask)) {
+                    slots[hole] = slots[i];
+                    hole = i;
+                }
+            }
+            slots[hole].object = VK_NULL_HANDLE;
+            --count;
+        }
+
+        void Grow() {
+            std::vector<Slot> old_slots(slots.empty() ? kMinSlots : slots.size() * 2);
+            for (auto &slot : old_slots) slot.object = VK_NULL_HANDLE;
+            // old_slots now holds the current entries, slots the larger empty table
+            old_slots.swap(slots);
+            size_t mask = slots.size() - 1;
+            for (auto &slot : old_slots) {
+                if (slot.object == VK_NULL_HANDLE) continue;
+                size_t i = Home(slot.object, mask);
+                while (slots[i].object != VK_NULL_HANDLE) i = (i + 1) & mask;
+                slots[i] = slot;
+            }
+        }
+
+        std::mutex lock;
+        std::condition_variable released;
+        int waiters;  // Threads waiting in released
+        size_t count;
+        std::vector<Slot> slots;
+    };
+
+    // Handles are often aligned pointers, so mix all the bits before picking a shard and a slot
+    static uint64_t Hash(T object) {
+        uint64_t h = HandleToUint64(object);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+    static size_t Home(T object, size_t mask) { return static_cast<size_t>(Hash(object) >> kShardBits) & mask; }
+    Shard &ShardFor(T object) { return shards_[Hash(object) & (kShardCount - 1)]; }
+
+    static void WaitUntilUnused(Shard &shard, std::unique_lock<std::mutex> &lock, T object) {
+        ++shard.waiters;
+        while (shard.Find(object)) {
+            shard.released.wait(lock);
+        }
+        --shard.waiters;
+    }
+
+    // Drop the entry once neither readers nor writers remain, and wake any threads waiting on this shard
+    static void Release(Shard &shard, std::unique_lock<std::mutex> &lock, T object, object_use_data *use_data) {
+        if ((use_data->reader_count != 0) || (use_data->writer_count != 0)) return;
+        shard.Erase(object);
+        bool notify = shard.waiters > 0;
+        lock.unlock();
+        // Notify any waiting threads that this object may be safe to use
+        if (notify) shard.released.notify_all();
+    }
+
+    Shard shards_[kShardCount];
 };
 
 struct layer_data {
@@ -391,7 +447,7 @@ WRAPPER(VkDebugUtilsMessengerEXT)
 WRAPPER(uint64_t)
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 static std::mutex command_pool_lock;
 static std::unordered_map<VkCommandBuffer, VkCommandPool> command_pool_map;
 
@@ -27,22 +27,73 @@
 #include "vk_layer_data.h"
 #include "vk_safe_struct.h"
 #include "vk_layer_utils.h"
+#include "handle_wrap_table.h"
 #include "mutex"
 
 #pragma once
 
 namespace unique_objects {
 
-// All increments must be guarded by global_lock
-static uint64_t global_unique_id = 1;
-static std::unordered_map<uint64_t, uint64_t> unique_id_mapping;  // Map uniqueID to actual object handle
+// Map uniqueID to actual object handle. Lookups are wait-free and the table does its own locking for inserts and erases,
+// so wrapping and unwrapping handles does not need global_lock.
+static HandleWrapTable unique_id_mapping;
+
+// One descriptor update entry of a template, reduced to what is needed to copy and unwrap its part of pData
+struct TemplateUnwrapStep {
+    enum Kind { kImageInfo, kBufferInfo, kBufferView };
+    Kind kind;
+    uint32_t count;
+    size_t offset;
+    size_t stride;
+};
 
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
+    // Built once at creation so that each update is a single copy-and-unwrap pass
+    std::vector<TemplateUnwrapStep> unwrap_plan;
+    size_t unwrapped_size;
 
     TEMPLATE_STATE(VkDescriptorUpdateTemplateKHR update_template, safe_VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : desc_update_template(update_template), create_info(*pCreateInfo) {}
+        : desc_update_template(update_template), create_info(*pCreateInfo), unwrapped_size(0) {
+        for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+            const VkDescriptorUpdateTemplateEntry &entry = create_info.pDescriptorUpdateEntries[i];
+            if (!entry.descriptorCount) continue;
+            TemplateUnwrapStep step;
+            size_t element_size;
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    step.kind = TemplateUnwrapStep::kImageInfo;
+                    element_size = sizeof(VkDescriptorImageInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    step.kind = TemplateUnwrapStep::kBufferInfo;
+                    element_size = sizeof(VkDescriptorBufferInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    step.kind = TemplateUnwrapStep::kBufferView;
+                    element_size = sizeof(VkBufferView);
+                    break;
+                default:
+                    assert(0);
+                    continue;
+            }
+            step.count = entry.descriptorCount;
+            step.offset = entry.offset;
+            step.stride = entry.stride;
+            unwrap_plan.push_back(step);
+            const size_t end = step.offset + (step.count - 1) * step.stride + element_size;
+            if (end > unwrapped_size) unwrapped_size = end;
+        }
+    }
 };
 
 struct instance_layer_data {
@@ -70,7 +121,8 @@ struct layer_data {
     debug_report_data *report_data;
     VkLayerDispatchTable dispatch_table = {};
 
-    std::unordered_map<uint64_t, std::unique_ptr<TEMPLATE_STATE>> desc_template_map;
+    // Read without global_lock when building unwrapped template update buffers
+    lock_util::ConcurrentUnorderedMap<uint64_t, std::unique_ptr<TEMPLATE_STATE>> desc_template_map;
 
     bool wsi_enabled;
     VkPhysicalDevice gpu;
@@ -89,10 +141,10 @@ struct layer_data {
     layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE){};
 };
 
-static std::unordered_map<void *, instance_layer_data *> instance_layer_data_map;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataMap<instance_layer_data> instance_layer_data_map;
+static LayerDataMap<layer_data> layer_data_map;
 
-static std::mutex global_lock;  // Protect map accesses and unique_id increments
+static std::mutex global_lock;  // Protect renderpasses_states and swapchain_wrapped_image_handle_map
 
 struct GenericHeader {
     VkStructureType sType;
@@ -116,20 +168,22 @@ bool ContainsExtStruct(const T *target, VkStructureType ext_type) {
     return false;
 }
 
-/* Unwrap a handle. */
-// must hold lock!
+/* Unwrap a handle. Unknown handles (including VK_NULL_HANDLE) unwrap to VK_NULL_HANDLE. */
 template <typename HandleType>
 HandleType Unwrap(HandleType wrappedHandle) {
-    // TODO: don't use operator[] here.
-    return (HandleType)unique_id_mapping[reinterpret_cast<uint64_t const &>(wrappedHandle)];
+    return (HandleType)unique_id_mapping.Find(reinterpret_cast<uint64_t const &>(wrappedHandle));
 }
 
-// Wrap a newly created handle with a new unique ID, and return the new ID -- must hold lock!
+// Wrap a newly created handle with a new unique ID, and return the new ID
 template <typename HandleType>
 HandleType WrapNew(HandleType newlyCreatedHandle) {
-    auto unique_id = global_unique_id++;
-    unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
-    return (HandleType)unique_id;
+    return (HandleType)unique_id_mapping.Insert(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
+}
+
+// Remove a wrapped handle from the map, returning the handle it wrapped
+template <typename HandleType>
+HandleType UnwrapAndErase(HandleType wrappedHandle) {
+    return (HandleType)unique_id_mapping.Erase(reinterpret_cast<uint64_t const &>(wrappedHandle));
 }
 
 }  // namespace unique_objects
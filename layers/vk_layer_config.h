@@ -67,6 +67,20 @@ VK_LAYER_EXPORT void PrintMessageFlags(VkFlags vk_flags, char *msg_flags);
 VK_LAYER_EXPORT void PrintMessageSeverity(VkFlags vk_flags, char *msg_flags);
 VK_LAYER_EXPORT void PrintMessageType(VkFlags vk_flags, char *msg_flags);
 
+// Log file output for the LOG_MSG debug action, shared by everything logging to the same log_filename. format is "text"
+// (the default) or "json" for one JSON object per line. An async writer queues lines for a background thread rather than
+// writing them on the calling thread.
+typedef struct LayerLogWriter LayerLogWriter;
+VK_LAYER_EXPORT LayerLogWriter *getLayerLogWriter(const char *_option, const char *layerName, const char *format, bool async);
+VK_LAYER_EXPORT void releaseLayerLogWriter(LayerLogWriter *writer);
+// Blocks until every queued line has been written
+VK_LAYER_EXPORT void flushLayerLogWriters();
+VK_LAYER_EXPORT void LayerLogReportMessage(LayerLogWriter *writer, VkFlags msg_flags, int32_t msg_code, const char *layer_prefix,
+                                           const char *message);
+VK_LAYER_EXPORT void LayerLogMessengerMessage(LayerLogWriter *writer, VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                              VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                              const VkDebugUtilsMessengerCallbackDataEXT *callback_data);
+
 #ifdef __cplusplus
 }
 #endif
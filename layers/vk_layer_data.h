@@ -20,36 +20,98 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <atomic>
 #include <cassert>
-#include <unordered_map>
+#include <cstdint>
+#include "concurrent_map.h"
 #include "vk_layer_table.h"
 
-// For the given data key, look up the layer_data instance from given layer_data_map
+// Dispatch key -> per-instance/per-device layer data, shared by all layers. Lookups take no lock and do not allocate; each
+// thread also caches its last hit, which is the common case since an application thread usually drives a single device.
 template <typename DATA_T>
-DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    DATA_T *debug_data;
-    typename std::unordered_map<void *, DATA_T *>::const_iterator got;
-
-    /* TODO: We probably should lock here, or have caller lock */
-    got = layer_data_map.find(data_key);
-
-    if (got == layer_data_map.end()) {
-        debug_data = new DATA_T;
-        layer_data_map[(void *)data_key] = debug_data;
-    } else {
-        debug_data = got->second;
+class LayerDataMap {
+   public:
+    using Map = lock_util::ConcurrentUnorderedMap<void *, DATA_T *>;
+    using iterator = typename Map::iterator;
+    using const_iterator = typename Map::const_iterator;
+
+    LayerDataMap() : generation_(0) {}
+
+    DATA_T *Lookup(void *data_key) {
+        LastHit &last = LocalLastHit();
+        const uint64_t generation = generation_.load(std::memory_order_acquire);
+        if ((last.map == this) && (last.key == data_key) && (last.generation == generation)) return last.data;
+
+        DATA_T *data;
+        {
+            lock_util::EpochGuard guard;
+            auto got = map_.find(data_key);
+            data = (got != map_.end()) ? got->second : nullptr;
+        }
+        if (data) last = {this, data_key, data, generation};
+        return data;
+    }
+
+    // Returns the existing entry if another thread won the race to create one
+    DATA_T *Create(void *data_key) {
+        DATA_T *data = new DATA_T;
+        auto inserted = map_.emplace(data_key, data);
+        if (!inserted.second) {
+            delete data;
+            data = inserted.first->second;
+        }
+        return data;
+    }
+
+    void Destroy(void *data_key) {
+        DATA_T *data = nullptr;
+        {
+            lock_util::EpochGuard guard;
+            auto got = map_.find(data_key);
+            assert(got != map_.end());
+            if (got != map_.end()) data = got->second;
+        }
+        map_.erase(data_key);
+        // Stale last-hit entries on other threads are rejected from here on; dispatch keys are reused by the loader
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        delete data;
     }
 
+    // Iteration is only for create/destroy-time cross-checks, so callers hold their layer's lock as before
+    iterator begin() { return map_.begin(); }
+    iterator end() { return map_.end(); }
+    const_iterator begin() const { return map_.begin(); }
+    const_iterator end() const { return map_.end(); }
+    size_t size() const { return map_.size(); }
+    bool empty() const { return map_.empty(); }
+
+   private:
+    struct LastHit {
+        const LayerDataMap *map;
+        void *key;
+        DATA_T *data;
+        uint64_t generation;
+    };
+    static LastHit &LocalLastHit() {
+        static thread_local LastHit last_hit = {nullptr, nullptr, nullptr, 0};
+        return last_hit;
+    }
+
+    Map map_;
+    std::atomic<uint64_t> generation_;
+};
+
+// For the given data key, look up the layer_data instance from given layer_data_map, creating it on first use
+template <typename DATA_T>
+DATA_T *GetLayerDataPtr(void *data_key, LayerDataMap<DATA_T> &layer_data_map) {
+    DATA_T *debug_data = layer_data_map.Lookup(data_key);
+    if (!debug_data) debug_data = layer_data_map.Create(data_key);
     return debug_data;
 }
 
 template <typename DATA_T>
-void FreeLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    auto got = layer_data_map.find(data_key);
-    assert(got != layer_data_map.end());
-
-    delete got->second;
-    layer_data_map.erase(got);
+void FreeLayerDataPtr(void *data_key, LayerDataMap<DATA_T> &layer_data_map) {
+    layer_data_map.Destroy(data_key);
 }
 
 #endif  // LAYER_DATA_H
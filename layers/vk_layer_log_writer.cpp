@@ -0,0 +1,373 @@
+/* Copyright (c) 2018 The Khronos Group Inc.
+ * Copyright (c) 2018 Valve Corporation
+ * Copyright (c) 2018 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "vk_layer_config.h"
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+// Log file output for the LOG_MSG debug action. One writer exists per log_filename and is shared by every callback (and, where
+// the utils library is shared, every layer) logging to that file, so lines from different sources never interleave.
+//
+// A synchronous writer formats and writes on the calling thread, as the layers always have. An asynchronous writer formats on
+// the calling thread and hands the bytes to a bounded multi-producer/single-consumer ring; one background thread drains the
+// ring and writes it out in large batches. Producers claim ring cells with a compare-and-swap and never take a lock unless
+// the writer thread is asleep or the ring is full.
+struct LayerLogWriter {
+   public:
+    LayerLogWriter(FILE *file, bool json, bool async)
+        : json(json), references(0), file_(file), async_(async), cells_(nullptr), enqueue_pos_(0), read_pos_(0),
+          written_pos_(0), sleeping_(false), stop_(false) {
+        if (!async_) return;
+        cells_ = new Cell[kCellCount];
+        for (uint64_t i = 0; i < kCellCount; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+        batch_.reserve(kBatchBytes + kCellBytes);
+        thread_ = std::thread(&LayerLogWriter::Run, this);
+    }
+
+    ~LayerLogWriter() {
+        if (async_) {
+            {
+                std::lock_guard<std::mutex> lock(wake_lock_);
+                stop_ = true;
+            }
+            wake_cv_.notify_one();
+            thread_.join();
+            delete[] cells_;
+        }
+        if (file_ != stdout) fclose(file_);
+    }
+
+    LayerLogWriter(const LayerLogWriter &) = delete;
+    LayerLogWriter &operator=(const LayerLogWriter &) = delete;
+
+    void Write(const char *text, size_t length) {
+        if (!async_) {
+            std::lock_guard<std::mutex> lock(file_lock_);
+            WriteToFile(text, length);
+            return;
+        }
+        uint64_t cells = (length + kCellBytes - 1) / kCellBytes;
+        if (cells == 0) return;
+        if (cells > kCellCount) {
+            // Too long for the ring: let everything queued so far go first, then write directly
+            Flush();
+            std::lock_guard<std::mutex> lock(file_lock_);
+            WriteToFile(text, length);
+            return;
+        }
+
+        // Claim cells [pos, pos + cells). The consumer frees cells in order, so the span is free once its last cell is.
+        uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            uint64_t last = pos + cells - 1;
+            int64_t diff = int64_t(cells_[last & kCellMask].sequence.load(std::memory_order_acquire)) - int64_t(last);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + cells, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // Ring is full; let the writer catch up
+                Wake();
+                std::this_thread::yield();
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        for (uint64_t i = 0; i < cells; ++i) {
+            Cell &cell = cells_[(pos + i) & kCellMask];
+            size_t chunk = length < kCellBytes ? length : kCellBytes;
+            memcpy(cell.data, text, chunk);
+            cell.length = static_cast<uint32_t>(chunk);
+            cell.last = (i + 1 == cells);
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+            text += chunk;
+            length -= chunk;
+        }
+        if (sleeping_.load(std::memory_order_acquire)) Wake();
+    }
+
+    // Returns once everything written before the call has reached the file. Bounded by a timeout, as the writer thread may
+    // already have been torn down if this runs during process exit.
+    void Flush() {
+        if (!async_) {
+            std::lock_guard<std::mutex> lock(file_lock_);
+            fflush(file_);
+            return;
+        }
+        uint64_t target = enqueue_pos_.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock(wake_lock_);
+        wake_cv_.notify_one();
+        flushed_cv_.wait_for(lock, std::chrono::seconds(1), [this, target] { return written_pos_ >= target; });
+    }
+
+    const bool json;
+    uint32_t references;  // Guarded by the writer registry lock
+
+   private:
+    static const uint64_t kCellCount = 1024;
+    static const uint64_t kCellMask = kCellCount - 1;
+    static const size_t kCellBytes = 248;
+    static const size_t kBatchBytes = 64 * 1024;
+
+    struct Cell {
+        std::atomic<uint64_t> sequence;  // Position + 1 once written, position + kCellCount once drained
+        uint32_t length;
+        bool last;  // Ends a line
+        char data[kCellBytes];
+    };
+
+    void Wake() {
+        std::lock_guard<std::mutex> lock(wake_lock_);
+        wake_cv_.notify_one();
+    }
+
+    void WriteToFile(const char *text, size_t length) {
+#if defined(_WIN32)
+        fwrite(text, 1, length, file_);
+        fflush(file_);
+#else
+        // Anything the FILE has buffered (e.g. application output on stdout) goes first
+        fflush(file_);
+        int fd = fileno(file_);
+        while (length) {
+            ssize_t written = write(fd, text, length);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            text += written;
+            length -= static_cast<size_t>(written);
+        }
+#endif
+    }
+
+    // Writer thread: drain the ring into one batch, write it, repeat; sleep briefly when there is nothing to do. Only whole
+    // lines are written, so a line written directly by Write never lands inside another.
+    void Run() {
+        size_t complete_bytes = 0;
+        uint64_t complete_pos = 0;
+        for (;;) {
+            while (batch_.size() < kBatchBytes || complete_bytes != batch_.size()) {
+                Cell &cell = cells_[read_pos_ & kCellMask];
+                if (cell.sequence.load(std::memory_order_acquire) != read_pos_ + 1) break;
+                batch_.append(cell.data, cell.length);
+                bool last = cell.last;
+                cell.sequence.store(read_pos_ + kCellCount, std::memory_order_release);
+                ++read_pos_;
+                if (last) {
+                    complete_bytes = batch_.size();
+                    complete_pos = read_pos_;
+                }
+            }
+            if (complete_bytes) {
+                {
+                    std::lock_guard<std::mutex> lock(file_lock_);
+                    WriteToFile(batch_.data(), complete_bytes);
+                }
+                batch_.erase(0, complete_bytes);
+                complete_bytes = 0;
+                {
+                    std::lock_guard<std::mutex> lock(wake_lock_);
+                    written_pos_ = complete_pos;
+                }
+                flushed_cv_.notify_all();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wake_lock_);
+            if (stop_ && enqueue_pos_.load(std::memory_order_acquire) == read_pos_) break;
+            sleeping_.store(true, std::memory_order_release);
+            // A producer that misses the sleeping flag is picked up by the timeout
+            wake_cv_.wait_for(lock, std::chrono::milliseconds(10));
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    FILE *file_;
+    const bool async_;
+    std::mutex file_lock_;
+
+    Cell *cells_;
+    std::atomic<uint64_t> enqueue_pos_;
+    uint64_t read_pos_;  // Writer thread only
+    std::string batch_;  // Writer thread only
+
+    std::mutex wake_lock_;
+    std::condition_variable wake_cv_;
+    std::condition_variable flushed_cv_;
+    uint64_t written_pos_;  // Guarded by wake_lock_
+    std::atomic<bool> sleeping_;
+    bool stop_;  // Guarded by wake_lock_
+
+    std::thread thread_;
+};
+
+// Writers by log_filename option. Never destroyed, so that an atexit flush can't race static destruction.
+static std::mutex &LogWriterRegistryLock() {
+    static std::mutex *lock = new std::mutex;
+    return *lock;
+}
+static std::map<std::string, LayerLogWriter *> &LogWriterRegistry() {
+    static std::map<std::string, LayerLogWriter *> *registry = new std::map<std::string, LayerLogWriter *>;
+    return *registry;
+}
+
+// If option is NULL or stdout, log to stdout, otherwise try to open option as a filename (see getLayerLogOutput).
+// Callers sharing a filename share its writer; the format and async options of the first caller apply.
+VK_LAYER_EXPORT LayerLogWriter *getLayerLogWriter(const char *_option, const char *layerName, const char *format, bool async) {
+    std::string key = _option ? _option : "stdout";
+    std::lock_guard<std::mutex> lock(LogWriterRegistryLock());
+    LayerLogWriter *&writer = LogWriterRegistry()[key];
+    if (!writer) {
+        bool json = format && !strcmp(format, "json");
+        writer = new LayerLogWriter(getLayerLogOutput(_option, layerName), json, async);
+        static bool flush_at_exit = false;
+        if (async && !flush_at_exit) {
+            flush_at_exit = true;
+            atexit(flushLayerLogWriters);
+        }
+    }
+    ++writer->references;
+    return writer;
+}
+
+VK_LAYER_EXPORT void releaseLayerLogWriter(LayerLogWriter *writer) {
+    std::lock_guard<std::mutex> lock(LogWriterRegistryLock());
+    if (--writer->references) return;
+    auto &registry = LogWriterRegistry();
+    for (auto it = registry.begin(); it != registry.end(); ++it) {
+        if (it->second == writer) {
+            registry.erase(it);
+            break;
+        }
+    }
+    // Drains the ring and closes the file
+    delete writer;
+}
+
+VK_LAYER_EXPORT void flushLayerLogWriters() {
+    std::lock_guard<std::mutex> lock(LogWriterRegistryLock());
+    for (auto &entry : LogWriterRegistry()) entry.second->Flush();
+}
+
+// Appends text to out as the body of a JSON string
+static void AppendJsonString(std::string *out, const char *text) {
+    if (!text) text = "";
+    for (; *text; ++text) {
+        unsigned char c = static_cast<unsigned char>(*text);
+        if (c == '"' || c == '\\') {
+            out->push_back('\\');
+            out->push_back(static_cast<char>(c));
+        } else if (c == '\n') {
+            *out += "\\n";
+        } else if (c < 0x20) {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            *out += escape;
+        } else {
+            out->push_back(static_cast<char>(c));
+        }
+    }
+}
+
+VK_LAYER_EXPORT void LayerLogReportMessage(LayerLogWriter *writer, VkFlags msg_flags, int32_t msg_code, const char *layer_prefix,
+                                           const char *message) {
+    char msg_flag_string[30];
+    PrintMessageFlags(msg_flags, msg_flag_string);
+
+    std::string line;
+    char text[96];
+    if (writer->json) {
+        line += "{\"layer\":\"";
+        AppendJsonString(&line, layer_prefix);
+        snprintf(text, sizeof(text), "\",\"flags\":\"%s\",\"msg_code\":%d,\"message\":\"", msg_flag_string, msg_code);
+        line += text;
+        AppendJsonString(&line, message);
+        line += "\"}\n";
+    } else {
+        line += layer_prefix;
+        snprintf(text, sizeof(text), "(%s): msg_code: %d: ", msg_flag_string, msg_code);
+        line += text;
+        line += message;
+        line += "\n";
+    }
+    writer->Write(line.data(), line.size());
+}
+
+VK_LAYER_EXPORT void LayerLogMessengerMessage(LayerLogWriter *writer, VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                              VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                              const VkDebugUtilsMessengerCallbackDataEXT *callback_data) {
+    char msg_severity[30];
+    char msg_type[30];
+    PrintMessageSeverity(message_severity, msg_severity);
+    PrintMessageType(message_type, msg_type);
+
+    std::string line;
+    char text[128];
+    if (writer->json) {
+        line += "{\"id\":\"";
+        AppendJsonString(&line, callback_data->pMessageIdName);
+        line += "\",\"severity\":\"";
+        line += msg_severity;
+        line += "\",\"type\":\"";
+        line += msg_type;
+        snprintf(text, sizeof(text), "\",\"msg_num\":%d,\"message\":\"", callback_data->messageIdNumber);
+        line += text;
+        AppendJsonString(&line, callback_data->pMessage);
+        line += "\",\"objects\":[";
+        for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
+            snprintf(text, sizeof(text), "%s{\"handle\":\"0x%" PRIx64 "\",\"type\":%d,\"name\":", obj ? "," : "",
+                     callback_data->pObjects[obj].objectHandle, callback_data->pObjects[obj].objectType);
+            line += text;
+            if (callback_data->pObjects[obj].pObjectName) {
+                line += "\"";
+                AppendJsonString(&line, callback_data->pObjects[obj].pObjectName);
+                line += "\"}";
+            } else {
+                line += "null}";
+            }
+        }
+        line += "]}\n";
+    } else {
+        line += callback_data->pMessageIdName ? callback_data->pMessageIdName : "(null)";
+        snprintf(text, sizeof(text), "(%s / %s): msgNum: %d - ", msg_severity, msg_type, callback_data->messageIdNumber);
+        line += text;
+        line += callback_data->pMessage;
+        snprintf(text, sizeof(text), "\n    Objects: %d\n", callback_data->objectCount);
+        line += text;
+        for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
+            snprintf(text, sizeof(text), "       [%d] 0x%" PRIx64 ", type: %d, name: ", obj,
+                     callback_data->pObjects[obj].objectHandle, callback_data->pObjects[obj].objectType);
+            line += text;
+            line += callback_data->pObjects[obj].pObjectName ? callback_data->pObjects[obj].pObjectName : "(null)";
+            line += "\n";
+        }
+    }
+    writer->Write(line.data(), line.size());
+}
@@ -32,10 +32,14 @@
 #include "vk_object_types.h"
 #include "vk_validation_error_messages.h"
 #include <signal.h>
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <sstream>
@@ -57,6 +61,120 @@ typedef struct _LoggingLabelData {
     float color[4];
 } LoggingLabelData;
 
+// Duplicate message suppression, enabled by the <LayerIdentifier>.duplicate_message_limit setting. Each distinct message
+// (severity, VUID or message code, object, layer prefix) is delivered at most limit times; later repeats are only counted, and
+// summarized by ReportSuppressedMessages. Messages are told apart by a 64-bit hash of that key. Logging threads claim a slot
+// with a compare-and-swap and count with an atomic increment, so they never take a lock. Keys that don't find a slot within
+// a few probes are never suppressed, and neither are kVUIDUndefined messages, which that key can't tell apart.
+class LogMessageLimiter {
+   public:
+    explicit LogMessageLimiter(uint64_t limit) : limit_(limit), slots_(new Slot[kCapacity]) {}
+    ~LogMessageLimiter() { delete[] slots_; }
+    LogMessageLimiter(const LogMessageLimiter &) = delete;
+    LogMessageLimiter &operator=(const LogMessageLimiter &) = delete;
+
+    uint64_t limit() const { return limit_; }
+
+    // Counts one occurrence of the message, returning true if it is over the limit and should be dropped
+    bool Suppress(VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type, uint64_t src_object, int32_t msg_code,
+                  const char *layer_prefix, const char *text_vuid) {
+        if (text_vuid && (0 == strcmp(text_vuid, kVUIDUndefined))) return false;
+        uint64_t key = Hash(msg_flags, object_type, src_object, msg_code, layer_prefix, text_vuid);
+        for (size_t probe = 0; probe < kMaxProbes; ++probe) {
+            Slot &slot = slots_[(key + probe) & (kCapacity - 1)];
+            uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+            if (slot_key == 0) {
+                if (slot.key.compare_exchange_strong(slot_key, key, std::memory_order_acq_rel)) {
+                    slot.msg_flags = msg_flags;
+                    slot.object_type = object_type;
+                    slot.src_object = src_object;
+                    slot.msg_code = msg_code;
+                    CopyTruncated(slot.layer_prefix, sizeof(slot.layer_prefix), layer_prefix);
+                    CopyTruncated(slot.text_vuid, sizeof(slot.text_vuid), text_vuid);
+                    slot.described.store(true, std::memory_order_release);
+                    slot_key = key;
+                }
+            }
+            if (slot_key == key) return slot.count.fetch_add(1, std::memory_order_relaxed) >= limit_;
+        }
+        return false;
+    }
+
+    // Appends a line to summary for each message that has had repeats dropped since the last call, and returns the number
+    // of repeats those lines account for
+    uint64_t TakeSuppressed(std::string *summary) {
+        std::lock_guard<std::mutex> lock(report_lock_);
+        uint64_t total = 0;
+        for (size_t i = 0; i < kCapacity; ++i) {
+            Slot &slot = slots_[i];
+            if (!slot.described.load(std::memory_order_acquire)) continue;
+            uint64_t count = slot.count.load(std::memory_order_relaxed);
+            uint64_t suppressed = count > limit_ ? count - limit_ : 0;
+            if (suppressed == slot.reported) continue;
+            char line[256];
+            snprintf(line, sizeof(line), "\n    %" PRIu64 " x [ %s ] code %d, %s, flags 0x%x, object 0x%" PRIx64 " (Type = %d)",
+                     suppressed - slot.reported, slot.text_vuid[0] ? slot.text_vuid : "-", slot.msg_code, slot.layer_prefix,
+                     slot.msg_flags, slot.src_object, static_cast<int>(slot.object_type));
+            *summary += line;
+            total += suppressed - slot.reported;
+            slot.reported = suppressed;
+        }
+        return total;
+    }
+
+   private:
+    static const size_t kCapacity = 1024;
+    static const size_t kMaxProbes = 16;
+
+    struct Slot {
+        Slot() : key(0), count(0), described(false), reported(0) {}
+        std::atomic<uint64_t> key;  // 0 while the slot is free
+        std::atomic<uint64_t> count;
+        // Set by the claiming thread once the fields below are written
+        std::atomic<bool> described;
+        uint64_t reported;  // Repeats already summarized, guarded by report_lock_
+        VkFlags msg_flags;
+        VkDebugReportObjectTypeEXT object_type;
+        uint64_t src_object;
+        int32_t msg_code;
+        char layer_prefix[32];
+        char text_vuid[128];
+    };
+
+    static void CopyTruncated(char *dst, size_t size, const char *src) {
+        if (!src) src = "";
+        size_t length = std::min(strlen(src), size - 1);
+        memcpy(dst, src, length);
+        dst[length] = '\0';
+    }
+
+    static uint64_t Hash(VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type, uint64_t src_object, int32_t msg_code,
+                         const char *layer_prefix, const char *text_vuid) {
+        // FNV-1a over the strings, then a 64-bit finalizer over everything
+        uint64_t h = 14695981039346656037ULL;
+        for (const char *c = layer_prefix ? layer_prefix : ""; *c; ++c) h = (h ^ uint8_t(*c)) * 1099511628211ULL;
+        h = (h ^ '|') * 1099511628211ULL;
+        for (const char *c = text_vuid ? text_vuid : ""; *c; ++c) h = (h ^ uint8_t(*c)) * 1099511628211ULL;
+        h ^= (uint64_t(msg_flags) << 32) ^ uint64_t(uint32_t(msg_code));
+        h = Mix(h) ^ src_object;
+        h = Mix(h) ^ uint64_t(object_type);
+        h = Mix(h);
+        return h ? h : 1;
+    }
+    static uint64_t Mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    const uint64_t limit_;
+    Slot *slots_;
+    std::mutex report_lock_;
+};
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list;
     VkLayerDbgFunctionNode *default_debug_callback_list;
@@ -70,10 +188,11 @@ typedef struct _debug_report_data {
     bool queueLabelHasInsert;
     std::unordered_map<VkCommandBuffer, std::vector<LoggingLabelData>> *debugUtilsCmdBufLabels;
     bool cmdBufLabelHasInsert;
+    LogMessageLimiter *message_limiter;  // Null unless a duplicate message limit is set
+    std::vector<LayerLogWriter *> *log_writers;  // Log file writers used by this instance's LOG_MSG callbacks
 } debug_report_data;
 
-template debug_report_data *GetLayerDataPtr<debug_report_data>(void *data_key,
-                                                               std::unordered_map<void *, debug_report_data *> &data_map);
+template debug_report_data *GetLayerDataPtr<debug_report_data>(void *data_key, LayerDataMap<debug_report_data> &data_map);
 
 static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags, bool default_flag_is_spec,
                                                 VkDebugUtilsMessageSeverityFlagsEXT *da_severity,
@@ -106,6 +225,9 @@ static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags,
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
                                  uint64_t src_object, size_t location, int32_t msg_code, const char *layer_prefix,
                                  const char *message, const char *text_vuid = NULL);
+static inline bool DeliverLogMsg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                                 uint64_t src_object, size_t location, int32_t msg_code, const char *layer_prefix,
+                                 const char *message, const char *text_vuid);
 
 // Add a debug message callback node structure to the specified callback linked list
 static inline void AddDebugCallbackNode(debug_report_data *debug_data, VkLayerDbgFunctionNode **list_head,
@@ -207,10 +329,82 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, VkLa
     *list_head = NULL;
 }
 
+// Messages held back from the callbacks, for validation that runs on several threads but must report in a fixed order
+class LogMessageBuffer {
+   public:
+    void Add(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type, uint64_t src_object,
+             size_t location, int32_t msg_code, const char *layer_prefix, const char *message, const char *text_vuid) {
+        messages_.push_back({debug_data, msg_flags, object_type, src_object, location, msg_code, layer_prefix, message,
+                             text_vuid ? text_vuid : "", text_vuid != nullptr});
+    }
+
+    // Delivers the held messages in logging order, returning true if any callback asked to abort the call
+    bool Flush() {
+        bool bail = false;
+        for (const auto &msg : messages_) {
+            bail |= DeliverLogMsg(msg.debug_data, msg.msg_flags, msg.object_type, msg.src_object, msg.location, msg.msg_code,
+                                  msg.layer_prefix.c_str(), msg.message.c_str(), msg.has_vuid ? msg.text_vuid.c_str() : nullptr);
+        }
+        messages_.clear();
+        return bail;
+    }
+
+   private:
+    struct Message {
+        const debug_report_data *debug_data;
+        VkFlags msg_flags;
+        VkDebugReportObjectTypeEXT object_type;
+        uint64_t src_object;
+        size_t location;
+        int32_t msg_code;
+        std::string layer_prefix;
+        std::string message;
+        std::string text_vuid;
+        bool has_vuid;
+    };
+    std::vector<Message> messages_;
+};
+
+// Buffer receiving this thread's messages instead of the callbacks, if any
+inline LogMessageBuffer *&LogCaptureTarget() {
+    static thread_local LogMessageBuffer *target = nullptr;
+    return target;
+}
+
+// Diverts messages logged on the calling thread into a LogMessageBuffer for the lifetime of the object. Callbacks only see
+// the messages at Flush, so their return values can't abort the captured work early: while capturing, every message reports
+// "don't bail" to its caller.
+class ScopedLogCapture {
+   public:
+    explicit ScopedLogCapture(LogMessageBuffer *buffer) : previous_(LogCaptureTarget()) { LogCaptureTarget() = buffer; }
+    ~ScopedLogCapture() { LogCaptureTarget() = previous_; }
+    ScopedLogCapture(const ScopedLogCapture &) = delete;
+    ScopedLogCapture &operator=(const ScopedLogCapture &) = delete;
+
+   private:
+    LogMessageBuffer *previous_;
+};
+
 // Note that text_vuid is a default parameter, and is optional.  See the above forward declaration
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
                                  uint64_t src_object, size_t location, int32_t msg_code, const char *layer_prefix,
                                  const char *message, const char *text_vuid) {
+    if (debug_data->message_limiter &&
+        debug_data->message_limiter->Suppress(msg_flags, object_type, src_object, msg_code, layer_prefix, text_vuid)) {
+        return false;
+    }
+    return DeliverLogMsg(debug_data, msg_flags, object_type, src_object, location, msg_code, layer_prefix, message, text_vuid);
+}
+
+// Hands a message that has passed the duplicate message limit to the capture buffer or the callbacks
+static inline bool DeliverLogMsg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                                 uint64_t src_object, size_t location, int32_t msg_code, const char *layer_prefix,
+                                 const char *message, const char *text_vuid) {
+    if (auto capture = LogCaptureTarget()) {
+        capture->Add(debug_data, msg_flags, object_type, src_object, location, msg_code, layer_prefix, message, text_vuid);
+        return false;
+    }
+
     bool bail = false;
     VkLayerDbgFunctionNode *layer_dbg_node = NULL;
 
@@ -248,11 +442,18 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
 
     VkDebugUtilsLabelEXT *queue_labels = nullptr;
     VkDebugUtilsLabelEXT *cmd_buf_labels = nullptr;
-    std::string new_debug_report_message = "";
-    std::ostringstream oss;
+    // VK_EXT_debug_report callbacks get the VUID and object description prepended to the message
+    std::string new_debug_report_message;
+    if (text_vuid != nullptr) {
+        new_debug_report_message += " [ ";
+        new_debug_report_message += text_vuid;
+        new_debug_report_message += " ] ";
+    }
+    char object_text[32];
 
     if (0 != src_object) {
-        oss << "Object: 0x" << std::hex << src_object;
+        snprintf(object_text, sizeof(object_text), "Object: 0x%" PRIx64, src_object);
+        new_debug_report_message += object_text;
         // If this is a queue, add any queue labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
             auto label_iter = debug_data->debugUtilsQueueLabels->find(reinterpret_cast<VkQueue>(src_object));
@@ -312,28 +513,23 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
             }
         }
         if (NULL != callback_data.pObjects[0].pObjectName) {
-            oss << " (Name = " << callback_data.pObjects[0].pObjectName << " : Type = ";
+            new_debug_report_message += " (Name = ";
+            new_debug_report_message += callback_data.pObjects[0].pObjectName;
+            new_debug_report_message += " : Type = ";
         } else {
-            oss << " (Type = ";
+            new_debug_report_message += " (Type = ";
         }
-        oss << std::to_string(object_type) << ")";
     } else {
-        oss << "Object: VK_NULL_HANDLE (Type = " << std::to_string(object_type) << ")";
+        new_debug_report_message += "Object: VK_NULL_HANDLE (Type = ";
     }
-    new_debug_report_message += oss.str();
+    snprintf(object_text, sizeof(object_text), "%d)", static_cast<int>(object_type));
+    new_debug_report_message += object_text;
     new_debug_report_message += " | ";
     new_debug_report_message += message;
 
     while (layer_dbg_node) {
         // If the app uses the VK_EXT_debug_report extension, call all of those registered callbacks.
         if (!layer_dbg_node->is_messenger && (layer_dbg_node->report.msgFlags & msg_flags)) {
-            if (text_vuid != nullptr) {
-                // If a text vuid is supplied for the old debug report extension, prepend it to the message string
-                new_debug_report_message.insert(0, " ] ");
-                new_debug_report_message.insert(0, text_vuid);
-                new_debug_report_message.insert(0, " [ ");
-            }
-
             if (layer_dbg_node->report.pfnMsgCallback(msg_flags, object_type, src_object, location, msg_code, layer_prefix,
                                                       new_debug_report_message.c_str(), layer_dbg_node->pUserData)) {
                 bail = true;
@@ -457,19 +653,39 @@ static inline debug_report_data *debug_utils_create_instance(
     debug_data->debugUtilsObjectNameMap = new std::unordered_map<uint64_t, std::string>;
     debug_data->debugUtilsQueueLabels = new std::unordered_map<VkQueue, std::vector<LoggingLabelData>>;
     debug_data->debugUtilsCmdBufLabels = new std::unordered_map<VkCommandBuffer, std::vector<LoggingLabelData>>;
+    debug_data->log_writers = new std::vector<LayerLogWriter *>;
     debug_data->queueLabelHasInsert = false;
     debug_data->cmdBufLabelHasInsert = false;
     return debug_data;
 }
 
+// Reports, as one warning against the given object, the repeats dropped by the duplicate message limit since the last report
+static inline void ReportSuppressedMessages(const debug_report_data *debug_data, VkDebugReportObjectTypeEXT object_type,
+                                            uint64_t object) {
+    if (!debug_data || !debug_data->message_limiter) return;
+    std::string summary;
+    uint64_t total = debug_data->message_limiter->TakeSuppressed(&summary);
+    if (!total) return;
+    char header[128];
+    snprintf(header, sizeof(header), "%" PRIu64 " repeated messages over the duplicate_message_limit of %" PRIu64 " were dropped:",
+             total, debug_data->message_limiter->limit());
+    DeliverLogMsg(debug_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, object_type, object, 0, 0, "Validation",
+                  (header + summary).c_str(), nullptr);
+}
+
 static inline void layer_debug_utils_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        ReportSuppressedMessages(debug_data, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0);
         RemoveAllMessageCallbacks(debug_data, &debug_data->default_debug_callback_list);
         RemoveAllMessageCallbacks(debug_data, &debug_data->debug_callback_list);
         delete debug_data->debugObjectNameMap;
         delete debug_data->debugUtilsObjectNameMap;
         delete debug_data->debugUtilsQueueLabels;
         delete debug_data->debugUtilsCmdBufLabels;
+        delete debug_data->message_limiter;
+        // The LOG_MSG callbacks are gone, so their writers can drain and close
+        for (auto writer : *debug_data->log_writers) releaseLayerLogWriter(writer);
+        delete debug_data->log_writers;
         free(debug_data);
     }
 }
@@ -806,32 +1022,31 @@ static inline int string_sprintf(std::string *output, const char *fmt, ...) {
     return result;
 }
 
-#ifdef WIN32
-static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
-    *strp = nullptr;
-    int size = _vscprintf(fmt, ap);
-    if (size >= 0) {
-        *strp = (char *)malloc(size + 1);
-        if (!*strp) {
-            return -1;
-        }
-        _vsnprintf(*strp, size + 1, fmt, ap);
-    }
-    return size;
+// Number of log_msg calls made on this thread, whether or not any callback wanted the message. Lets a caller tell whether a
+// validation pass was silent regardless of the callbacks currently registered.
+inline uint64_t &LogMsgCount() {
+    static thread_local uint64_t count = 0;
+    return count;
 }
-#endif
 
 // Output log message via DEBUG_REPORT. Takes format and variable arg list so that output string is only computed if a message
-// needs to be logged
+// needs to be logged. A message that no callback wants costs no allocation; the VUID may be passed as a string literal, a
+// std::string, or a numerical VUID abstraction.
 #ifndef WIN32
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
                            uint64_t src_object, int32_t msg_code, const char *format, ...) __attribute__((format(printf, 6, 7)));
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, std::string vuid_text, const char *format, ...)
+                           uint64_t src_object, const char *vuid_text, const char *format, ...)
     __attribute__((format(printf, 6, 7)));
-#endif
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, int32_t msg_code, const char *format, ...) {
+                           uint64_t src_object, const std::string &vuid_text, const char *format, ...)
+    __attribute__((format(printf, 6, 7)));
+#endif
+
+// Common body of the log_msg overloads. vuid_text, if not null, replaces msg_code.
+static inline bool vlog_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                            uint64_t src_object, int32_t msg_code, const char *vuid_text, const char *format, va_list argptr) {
+    LogMsgCount()++;
     VkFlags local_severity = 0;
     VkFlags local_type = 0;
     DebugReportFlagsToAnnotFlags(msg_flags, true, &local_severity, &local_type);
@@ -839,77 +1054,76 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flag
         // Message is not wanted
         return false;
     }
-
-    va_list argptr;
-    va_start(argptr, format);
-    char *str;
-    if (-1 == vasprintf(&str, format, argptr)) {
-        // On failure, glibc vasprintf leaves str undefined
-        str = nullptr;
+    // Repeats over the duplicate message limit are dropped before anything is formatted
+    if (debug_data->message_limiter &&
+        debug_data->message_limiter->Suppress(msg_flags, object_type, src_object, msg_code, "Validation", vuid_text)) {
+        return false;
     }
-    va_end(argptr);
 
-    std::string str_plus_spec_text(str);
-
-    // If the msg_code is in the error map, tack on spec text to error message.
-    if (validation_error_map.find(msg_code) != validation_error_map.end()) {
-        str_plus_spec_text += " ";
-        str_plus_spec_text += validation_error_map[msg_code];
+    // If the VUID is in the error map, recover the legacy numerical VUID and tack the spec text onto the message
+    if (vuid_text) msg_code = GetValidationErrorCode(vuid_text);
+    const char *spec_text = GetValidationErrorSpecText(msg_code);
+    size_t spec_length = spec_text ? strlen(spec_text) + 1 : 0;
+
+    // Format into a stack buffer, spilling to the heap only for long messages
+    char stack_buffer[1024];
+    std::vector<char> heap_buffer;
+    char *text = stack_buffer;
+    va_list argcopy;
+    va_copy(argcopy, argptr);
+    int length = vsnprintf(stack_buffer, sizeof(stack_buffer), format, argptr);
+    if (length >= 0 && size_t(length) + spec_length >= sizeof(stack_buffer)) {
+        heap_buffer.resize(size_t(length) + spec_length + 1);
+        text = heap_buffer.data();
+        vsnprintf(text, heap_buffer.size(), format, argcopy);
+    }
+    va_end(argcopy);
+    if (length < 0) {
+        strcpy(stack_buffer, "Message formatting failure");
+        length = static_cast<int>(strlen(stack_buffer));
+    }
+    if (spec_text) {
+        text[length] = ' ';
+        memcpy(text + length + 1, spec_text, spec_length);
     }
 
-    bool result = debug_log_msg(debug_data, msg_flags, object_type, src_object, 0, msg_code, "Validation",
-                                str_plus_spec_text.c_str() ? str_plus_spec_text.c_str() : "Allocation failure");
-    free(str);
-    return result;
+    return DeliverLogMsg(debug_data, msg_flags, object_type, src_object, 0, msg_code, "Validation", text, vuid_text);
 }
 
-// Overload of log_msg that takes a VUID string in place of a numerical VUID abstraction
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, std::string vuid_text, const char *format, ...) {
-    VkFlags local_severity = 0;
-    VkFlags local_type = 0;
-    DebugReportFlagsToAnnotFlags(msg_flags, true, &local_severity, &local_type);
-    if (!debug_data || !(debug_data->active_severities & local_severity) || !(debug_data->active_types & local_type)) {
-        // Message is not wanted
-        return false;
-    }
-
+                           uint64_t src_object, int32_t msg_code, const char *format, ...) {
     va_list argptr;
     va_start(argptr, format);
-    char *str;
-    if (-1 == vasprintf(&str, format, argptr)) {
-        // On failure, glibc vasprintf leaves str undefined
-        str = nullptr;
-    }
+    bool result = vlog_msg(debug_data, msg_flags, object_type, src_object, msg_code, nullptr, format, argptr);
     va_end(argptr);
+    return result;
+}
 
-    std::string str_plus_spec_text(str);
-
-    // If the vuid string is in the error map: find the legacy enum, look up spec text, and tack it onto error message.
-    int32_t legacy_vuid_enum = VALIDATION_ERROR_UNDEFINED;
-    if (validation_error_text_map.find(vuid_text.c_str()) != validation_error_text_map.end()) {
-        legacy_vuid_enum = validation_error_text_map[vuid_text.c_str()];
-        str_plus_spec_text += " ";
-        str_plus_spec_text += validation_error_map[legacy_vuid_enum];
-    }
-
-    // Append layer prefix with VUID string, pass in recovered legacy numerical VUID
-    bool result = debug_log_msg(debug_data, msg_flags, object_type, src_object, 0, legacy_vuid_enum, "Validation",
-                                str_plus_spec_text.c_str() ? str_plus_spec_text.c_str() : "Allocation failure", vuid_text.c_str());
+// Overloads of log_msg that take a VUID string in place of a numerical VUID abstraction
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                           uint64_t src_object, const char *vuid_text, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    bool result =
+        vlog_msg(debug_data, msg_flags, object_type, src_object, VALIDATION_ERROR_UNDEFINED, vuid_text, format, argptr);
+    va_end(argptr);
+    return result;
+}
 
-    free(str);
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                           uint64_t src_object, const std::string &vuid_text, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    bool result = vlog_msg(debug_data, msg_flags, object_type, src_object, VALIDATION_ERROR_UNDEFINED, vuid_text.c_str(), format,
+                           argptr);
+    va_end(argptr);
     return result;
 }
 
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
                                                                  uint64_t src_object, size_t location, int32_t msg_code,
                                                                  const char *layer_prefix, const char *message, void *user_data) {
-    char msg_flag_string[30];
-
-    PrintMessageFlags(msg_flags, msg_flag_string);
-
-    fprintf((FILE *)user_data, "%s(%s): msg_code: %d: %s\n", layer_prefix, msg_flag_string, msg_code, message);
-    fflush((FILE *)user_data);
+    LayerLogReportMessage(static_cast<LayerLogWriter *>(user_data), msg_flags, msg_code, layer_prefix, message);
 
     return false;
 }
@@ -934,6 +1148,8 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_win32_debug_output_msg(VkFla
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL DebugBreakCallback(VkFlags msgFlags, VkDebugReportObjectTypeEXT obj_type,
                                                                 uint64_t src_object, size_t location, int32_t msg_code,
                                                                 const char *layer_prefix, const char *message, void *user_data) {
+    // Don't lose queued log output if the break turns out to be fatal
+    flushLayerLogWriters();
 #ifdef WIN32
     DebugBreak();
 #else
@@ -947,21 +1163,7 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_log_callback(VkDebugUtils
                                                                     VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
                                                                     void *user_data) {
-    char msg_severity[30];
-    char msg_type[30];
-
-    PrintMessageSeverity(message_severity, msg_severity);
-    PrintMessageType(message_type, msg_type);
-
-    fprintf((FILE *)user_data, "%s(%s / %s): msgNum: %d - %s\n", callback_data->pMessageIdName, msg_severity, msg_type,
-            callback_data->messageIdNumber, callback_data->pMessage);
-    fprintf((FILE *)user_data, "    Objects: %d\n", callback_data->objectCount);
-    for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
-        fprintf((FILE *)user_data, "       [%d] 0x%" PRIx64 ", type: %d, name: %s\n", obj,
-                callback_data->pObjects[obj].objectHandle, callback_data->pObjects[obj].objectType,
-                callback_data->pObjects[obj].pObjectName);
-    }
-    fflush((FILE *)user_data);
+    LayerLogMessengerMessage(static_cast<LayerLogWriter *>(user_data), message_severity, message_type, callback_data);
 
     return false;
 }
@@ -19,6 +19,7 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <vector>
@@ -80,6 +81,19 @@ VK_LAYER_EXPORT bool white_list(const char *item, const char *list) {
     return (white_list.find(candidate) != std::string::npos);
 }
 
+// Opens (or shares) the log file writer named by the layer's log_filename, log_format and log_async settings. The writer is
+// released along with the instance's debug data.
+static LayerLogWriter *AcquireLayerLogWriter(debug_report_data *report_data, const char *layer_identifier) {
+    std::string key = layer_identifier;
+    const char *log_filename = getLayerOption((key + ".log_filename").c_str());
+    const char *log_format = getLayerOption((key + ".log_format").c_str());
+    const char *log_async = getLayerOption((key + ".log_async").c_str());
+    LayerLogWriter *log_writer =
+        getLayerLogWriter(log_filename, layer_identifier, log_format, log_async && (0 == strcmp(log_async, "true")));
+    report_data->log_writers->push_back(log_writer);
+    return log_writer;
+}
+
 // Debug callbacks get created in three ways:
 //   o  Application-defined debug callbacks
 //   o  Through settings in a vk_layer_settings.txt file
@@ -98,10 +112,10 @@ VK_LAYER_EXPORT void layer_debug_report_actions(debug_report_data *report_data,
 
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
-    std::string log_filename_key = layer_identifier;
+    std::string duplicate_limit_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
-    log_filename_key.append(".log_filename");
+    duplicate_limit_key.append(".duplicate_message_limit");
 
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
@@ -109,15 +123,20 @@ VK_LAYER_EXPORT void layer_debug_report_actions(debug_report_data *report_data,
     // Flag as default if these settings are not from a vk_layer_settings.txt file
     bool default_layer_callback = (debug_action & VK_DBG_LAYER_ACTION_DEFAULT) ? true : false;
 
+    const char *duplicate_limit = getLayerOption(duplicate_limit_key.c_str());
+    if (duplicate_limit && *duplicate_limit && !report_data->message_limiter) {
+        uint64_t limit = strtoull(duplicate_limit, nullptr, 10);
+        if (limit) report_data->message_limiter = new LogMessageLimiter(limit);
+    }
+
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
-        const char *log_filename = getLayerOption(log_filename_key.c_str());
-        FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
+        LayerLogWriter *log_writer = AcquireLayerLogWriter(report_data, layer_identifier);
         VkDebugReportCallbackCreateInfoEXT dbgCreateInfo;
         memset(&dbgCreateInfo, 0, sizeof(dbgCreateInfo));
         dbgCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT;
         dbgCreateInfo.flags = report_flags;
         dbgCreateInfo.pfnCallback = report_log_callback;
-        dbgCreateInfo.pUserData = (void *)log_output;
+        dbgCreateInfo.pUserData = (void *)log_writer;
         layer_create_report_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &callback);
         logging_callback.push_back(callback);
     }
@@ -156,10 +175,8 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
 
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
-    std::string log_filename_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
-    log_filename_key.append(".log_filename");
 
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
@@ -188,10 +205,9 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
     }
 
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
-        const char *log_filename = getLayerOption(log_filename_key.c_str());
-        FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
+        LayerLogWriter *log_writer = AcquireLayerLogWriter(report_data, layer_identifier);
         dbgCreateInfo.pfnUserCallback = messenger_log_callback;
-        dbgCreateInfo.pUserData = (void *)log_output;
+        dbgCreateInfo.pUserData = (void *)log_writer;
         layer_create_messenger_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &messenger);
         logging_messenger.push_back(messenger);
     }
@@ -195,27 +195,37 @@ class Specification:
         file_contents.append('\n#pragma once')
         file_contents.append('\n// Disable auto-formatting for generated file')
         file_contents.append('// clang-format off')
-        file_contents.append('\n#include <string>')
-        file_contents.append('#include <unordered_map>')
+        file_contents.append('\n#include <algorithm>')
+        file_contents.append('#include <cstddef>')
+        file_contents.append('#include <cstring>')
         file_contents.append('\n// enum values for unique validation error codes')
         file_contents.append('//  Corresponding validation error message for each enum is given in the mapping table below')
         file_contents.append('//  When a given error occurs, these enum values should be passed to the as the messageCode')
         file_contents.append('//  parameter to the PFN_vkDebugReportCallbackEXT function')
         enum_decl = ['enum UNIQUE_VALIDATION_ERROR_CODE {\n    VALIDATION_ERROR_UNDEFINED = -1,']
-        vuid_int_to_error_map_decl = 'std::unordered_map<int, char const *const> validation_error_map'
-        vuid_int_to_error_map = [ '#ifdef VALIDATION_ERROR_MAP_IMPL', vuid_int_to_error_map_decl + ' {']
-        vuid_string_to_error_map_decl = 'std::unordered_map<std::string, int> validation_error_text_map'
-        vuid_string_to_error_map = [ '#ifdef VALIDATION_ERROR_MAP_IMPL', vuid_string_to_error_map_decl + ' {']
         enum_value = 0
         max_enum_val = 0
         for enum in sorted(self.error_db_dict):
             enum_decl.append('    %s = 0x%s,' % (enum, enum[-8:]))
-            vuid_int_to_error_map.append('    {%s, "%s"},' % (enum, self.error_db_dict[enum]['error_msg'].replace('"', '\\"')))
-            vuid_str = self.error_db_dict[enum]['vuid_string']
-            vuid_string_to_error_map.append('    {"%s", %s},' % (vuid_str, enum))
             max_enum_val = max(max_enum_val, enum_value)
         enum_decl.append('    %sMAX_ENUM = %d,' % (validation_error_enum_name, max_enum_val + 1))
         enum_decl.append('};')
+        # The lookup tables are plain sorted arrays so that they are constant-initialized and searched with a binary search,
+        #  rather than hash maps built by static constructors at layer load
+        def enumSortKey(enum):
+            value = int(enum[-8:], 16)
+            return value - (1 << 32) if value >= (1 << 31) else value
+        table_size_decl = 'static const size_t validation_error_table_size = %d;' % (len(self.error_db_dict))
+        vuid_int_to_error_map_decl = 'const ValidationErrorSpecEntry validation_error_spec_table[validation_error_table_size]'
+        vuid_int_to_error_map = [ '#ifdef VALIDATION_ERROR_MAP_IMPL', 'extern ' + vuid_int_to_error_map_decl + ' = {']
+        for enum in sorted(self.error_db_dict, key=enumSortKey):
+            vuid_int_to_error_map.append('    {%s, "%s"},' % (enum, self.error_db_dict[enum]['error_msg'].replace('"', '\\"')))
+        vuid_string_to_error_map_decl = 'const ValidationErrorVuidEntry validation_error_vuid_table[validation_error_table_size]'
+        vuid_string_to_error_map = [ '#ifdef VALIDATION_ERROR_MAP_IMPL', 'extern ' + vuid_string_to_error_map_decl + ' = {']
+        # Python string ordering matches strcmp() for the ASCII VUID strings
+        for enum in sorted(self.error_db_dict, key=lambda enum: self.error_db_dict[enum]['vuid_string']):
+            vuid_str = self.error_db_dict[enum]['vuid_string']
+            vuid_string_to_error_map.append('    {"%s", %s},' % (vuid_str, enum))
         vuid_int_to_error_map.extend([
             '};',
             '#else',
@@ -227,10 +237,29 @@ class Specification:
             'extern ' + vuid_string_to_error_map_decl + ';',
             '#endif\n'])
         file_contents.extend(enum_decl)
-        file_contents.append('\n// Mapping from unique validation error enum to the corresponding spec text')
+        file_contents.append('\n// Validation error lookup tables')
+        file_contents.append('//  Both tables are sorted, read-only arrays with no static constructors, and lookups into them do not allocate')
+        file_contents.append('struct ValidationErrorSpecEntry {\n    int code;\n    char const *text;\n};')
+        file_contents.append('struct ValidationErrorVuidEntry {\n    char const *vuid;\n    int code;\n};')
+        file_contents.append(table_size_decl)
+        file_contents.append('\n// Mapping from unique validation error enum to the corresponding spec text, sorted by enum value')
         file_contents.extend(vuid_int_to_error_map)
-        file_contents.append('\n// Mapping from spec validation error text string to unique validation error enum')
+        file_contents.append('// Mapping from spec validation error text string to unique validation error enum, sorted by string')
         file_contents.extend(vuid_string_to_error_map)
+        file_contents.append('// Return the spec text for a unique validation error enum, or nullptr if there is none')
+        file_contents.append('static inline char const *GetValidationErrorSpecText(int code) {')
+        file_contents.append('    auto end = validation_error_spec_table + validation_error_table_size;')
+        file_contents.append('    auto entry = std::lower_bound(validation_error_spec_table, end, code,')
+        file_contents.append('                                  [](ValidationErrorSpecEntry const &lhs, int rhs) { return lhs.code < rhs; });')
+        file_contents.append('    return (entry != end && entry->code == code) ? entry->text : nullptr;')
+        file_contents.append('}\n')
+        file_contents.append('// Return the unique validation error enum for a spec validation error text string, or VALIDATION_ERROR_UNDEFINED')
+        file_contents.append('static inline int GetValidationErrorCode(char const *vuid) {')
+        file_contents.append('    auto end = validation_error_vuid_table + validation_error_table_size;')
+        file_contents.append('    auto entry = std::lower_bound(validation_error_vuid_table, end, vuid,')
+        file_contents.append('                                  [](ValidationErrorVuidEntry const &lhs, char const *rhs) { return strcmp(lhs.vuid, rhs) < 0; });')
+        file_contents.append('    return (entry != end && strcmp(entry->vuid, vuid) == 0) ? entry->code : VALIDATION_ERROR_UNDEFINED;')
+        file_contents.append('}\n')
         #print ("File contents: %s" % (file_contents))
         with open(header_file, "w") as outfile:
             outfile.write("\n".join(file_contents))
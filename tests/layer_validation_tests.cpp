@@ -6928,6 +6928,59 @@ TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyed) {
     vkFreeMemory(m_device->handle(), mem, NULL);
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferVertexBufferDestroyed) {
+    TEST_DESCRIPTION("Destroy a vertex buffer bound in a recorded command buffer, then attempt to submit the command buffer.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    VkMemoryRequirements mem_reqs;
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    buf_info.size = 256;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkResult err = vkCreateBuffer(m_device->device(), &buf_info, NULL, &buffer);
+    ASSERT_VK_SUCCESS(err);
+
+    vkGetBufferMemoryRequirements(m_device->device(), buffer, &mem_reqs);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_reqs.size;
+    bool pass = m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, 0);
+    if (!pass) {
+        printf("%s Failed to set memory type.\n", kSkipPrefix);
+        vkDestroyBuffer(m_device->device(), buffer, NULL);
+        return;
+    }
+    err = vkAllocateMemory(m_device->device(), &alloc_info, NULL, &mem);
+    ASSERT_VK_SUCCESS(err);
+
+    err = vkBindBufferMemory(m_device->device(), buffer, mem, 0);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDeviceSize offset = 0;
+    m_commandBuffer->begin();
+    vkCmdBindVertexBuffers(m_commandBuffer->handle(), 0, 1, &buffer, &offset);
+    m_commandBuffer->end();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    // Destroying the vertex buffer must invalidate the command buffer, so submitting it is an ERROR
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+    m_errorMonitor->VerifyFound();
+    vkQueueWaitIdle(m_device->m_queue);
+    vkFreeMemory(m_device->handle(), mem, NULL);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferBufferViewDestroyed) {
     TEST_DESCRIPTION("Delete bufferView bound to cmd buffer, then attempt to submit cmd buffer.");
 
@@ -16534,6 +16587,66 @@ TEST_F(VkLayerTest, ThreadCommandBufferCollision) {
 
     vkDestroyEvent(device(), event, NULL);
 }
+
+extern "C" void *SetDynamicStateOnCommandBuffer(void *arg) {
+    struct thread_data_struct *data = (struct thread_data_struct *)arg;
+
+    const float blend_constants[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    for (int i = 0; i < 80000; i++) {
+        vkCmdSetLineWidth(data->commandBuffer, 1.0f);
+        vkCmdSetBlendConstants(data->commandBuffer, blend_constants);
+        vkCmdSetStencilReference(data->commandBuffer, VK_STENCIL_FACE_FRONT_AND_BACK, 0);
+        if (data->bailout) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+TEST_F(VkPositiveLayerTest, ThreadRecordSeparateCommandBuffers) {
+    TEST_DESCRIPTION(
+        "Record dynamic state into two command buffers from two threads at the same time, with core validation's fine-grained "
+        "locking enabled.");
+#if defined(_WIN32) || defined(ANDROID)
+    // Layer options set here only reach the layers where they share the VkLayer_utils shared library with the test
+    printf("%s Cannot set layer options from the test on this platform, skipping test.\n", kSkipPrefix);
+#else
+    test_platform_thread thread;
+
+    // Core validation reads the option when the instance is created, and that instance's devices keep the mode it selected
+    const char *option = "lunarg_core_validation.fine_grained_locking";
+    const std::string previous_value = getLayerOption(option);
+    setLayerOption(option, "true");
+    InitFramework(myDbgFunc, m_errorMonitor);
+    setLayerOption(option, previous_value.c_str());
+    ASSERT_FALSE(HasFatalFailure());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // Pools are externally synchronized too, so give each thread its own
+    VkCommandPoolObj pool_a(m_device, m_device->graphics_queue_node_index_);
+    VkCommandPoolObj pool_b(m_device, m_device->graphics_queue_node_index_);
+    VkCommandBufferObj command_buffer_a(m_device, &pool_a);
+    VkCommandBufferObj command_buffer_b(m_device, &pool_b);
+    command_buffer_a.begin();
+    command_buffer_b.begin();
+
+    struct thread_data_struct data_a;
+    data_a.commandBuffer = command_buffer_a.handle();
+    data_a.bailout = false;
+    struct thread_data_struct data_b;
+    data_b.commandBuffer = command_buffer_b.handle();
+    data_b.bailout = false;
+
+    m_errorMonitor->ExpectSuccess();
+    test_platform_thread_create(&thread, SetDynamicStateOnCommandBuffer, (void *)&data_a);
+    SetDynamicStateOnCommandBuffer(&data_b);
+    test_platform_thread_join(thread, NULL);
+    m_errorMonitor->VerifyNotFound();
+
+    command_buffer_a.end();
+    command_buffer_b.end();
+#endif
+}
 #endif  // GTEST_IS_THREADSAFE
 
 TEST_F(VkLayerTest, InvalidSPIRVCodeSize) {
@@ -18393,6 +18506,50 @@ TEST_F(VkLayerTest, CreatePipelineInputAttachmentMissing) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, CreatePipelineInputAttachmentMissingNonZeroIndex) {
+    TEST_DESCRIPTION(
+        "Test that an error is produced for a shader consuming an input attachment at an index other than 0 which is not "
+        "included in the subpass description");
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         "consumes input attachment index 1 but not provided in subpass");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "void main(){\n"
+        "    gl_Position = vec4(1);\n"
+        "}\n";
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(input_attachment_index=1, set=0, binding=0) uniform subpassInput x;\n"
+        "layout(location=0) out vec4 color;\n"
+        "void main() {\n"
+        "   color = subpassLoad(x);\n"
+        "}\n";
+
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkDescriptorSetLayoutBinding dslb = {0, VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+    const VkDescriptorSetLayoutObj dsl(m_device, {dslb});
+
+    const VkPipelineLayoutObj pl(m_device, {&dsl});
+
+    // error here.
+    pipe.CreateVKPipeline(pl.handle(), renderPass());
+
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, CreatePipelineInputAttachmentTypeMismatch) {
     TEST_DESCRIPTION(
         "Test that an error is produced for a shader consuming an input attachment with a format having a different fundamental "
@@ -27998,6 +28155,72 @@ TEST_F(VkPositiveLayerTest, CreatePipelineInputAttachmentPositive) {
     vkDestroyRenderPass(m_device->device(), rp, nullptr);
 }
 
+TEST_F(VkPositiveLayerTest, CreatePipelineInputAttachmentNonZeroIndexPositive) {
+    TEST_DESCRIPTION("Positive test for a correctly matched input attachment at an index other than 0");
+    m_errorMonitor->ExpectSuccess();
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    char const *vsSource =
+        "#version 450\n"
+        "\n"
+        "void main(){\n"
+        "    gl_Position = vec4(1);\n"
+        "}\n";
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(input_attachment_index=1, set=0, binding=0) uniform subpassInput x;\n"
+        "layout(location=0) out vec4 color;\n"
+        "void main() {\n"
+        "   color = subpassLoad(x);\n"
+        "}\n";
+
+    VkShaderObj vs(m_device, vsSource, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkDescriptorSetLayoutBinding dslb = {0, VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+    const VkDescriptorSetLayoutObj dsl(m_device, {dslb});
+    const VkPipelineLayoutObj pl(m_device, {&dsl});
+
+    VkAttachmentDescription descs[2] = {
+        {0, VK_FORMAT_R8G8B8A8_UNORM, VK_SAMPLE_COUNT_1_BIT, VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE,
+         VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+         VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL},
+        {0, VK_FORMAT_R8G8B8A8_UNORM, VK_SAMPLE_COUNT_1_BIT, VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE,
+         VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL},
+    };
+    VkAttachmentReference color = {
+        0,
+        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+    };
+    // Input attachment index 0 is unused; index 1 is the one the shader reads
+    VkAttachmentReference inputs[2] = {
+        {VK_ATTACHMENT_UNUSED, VK_IMAGE_LAYOUT_GENERAL},
+        {1, VK_IMAGE_LAYOUT_GENERAL},
+    };
+
+    VkSubpassDescription sd = {0, VK_PIPELINE_BIND_POINT_GRAPHICS, 2, inputs, 1, &color, nullptr, nullptr, 0, nullptr};
+
+    VkRenderPassCreateInfo rpci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 2, descs, 1, &sd, 0, nullptr};
+    VkRenderPass rp;
+    VkResult err = vkCreateRenderPass(m_device->device(), &rpci, nullptr, &rp);
+    ASSERT_VK_SUCCESS(err);
+
+    // should be OK. would go wrong here if it's going to...
+    pipe.CreateVKPipeline(pl.handle(), rp);
+
+    m_errorMonitor->VerifyNotFound();
+
+    vkDestroyRenderPass(m_device->device(), rp, nullptr);
+}
+
 TEST_F(VkPositiveLayerTest, CreateComputePipelineMissingDescriptorUnusedPositive) {
     TEST_DESCRIPTION(
         "Test that pipeline validation accepts a compute pipeline which declares a descriptor-backed resource which is not "